@@ -0,0 +1,79 @@
+#include "../include/AssetCache.hpp"
+#include "raylib.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Loads every PNG under assets/ through a raylib::AssetCache once per simulated restart, keeping the handles of the
+// previous round alive the way the games do, then releases them all. Images need no window, so this runs headless.
+// Only the first round should decode anything; every later one must be all cache hits.
+// Compile command:  g++ asset_cache_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [restarts] [assets directory]
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+double elapsedMs(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  int restarts = argc > 1 ? std::atoi(argv[1]) : 100;
+  std::string directory = argc > 2 ? argv[2] : "../assets";
+  if (restarts < 1)
+  {
+    std::fprintf(stderr, "usage: %s [restarts] [assets directory]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  std::vector<std::string> files;
+  for (const auto &entry : std::filesystem::directory_iterator(directory))
+  {
+    if (entry.path().extension() == ".png")
+    {
+      files.push_back(entry.path().string());
+    }
+  }
+  std::sort(files.begin(), files.end());
+
+  ::SetTraceLogLevel(::LOG_WARNING);
+  raylib::AssetCache assets;
+  std::vector<raylib::AssetCache::Handle<raylib::Image>> images(files.size());
+
+  auto start = Clock::now();
+  for (size_t i = 0; i < files.size(); ++i)
+  {
+    images[i] = assets.LoadImage(files[i]);
+  }
+  double firstMs = elapsedMs(start);
+  long long firstMisses = assets.GetStats().misses;
+
+  start = Clock::now();
+  for (int r = 1; r < restarts; ++r)
+  {
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+      images[i] = assets.LoadImage(files[i]);
+    }
+  }
+  double restartMs = restarts > 1 ? elapsedMs(start) / (restarts - 1) : 0.0;
+
+  const raylib::AssetCache::Stats &stats = assets.GetStats();
+  std::printf("%d images in %s, %d loaded\n", (int)files.size(), directory.c_str(), assets.Count());
+  std::printf("first load %.3f ms (%lld decoded), each restart %.6f ms (%lld decoded in %d restarts)\n", firstMs,
+              firstMisses, restartMs, stats.misses - firstMisses, restarts - 1);
+
+  images.clear();
+  std::printf("after release %d loaded\n", assets.Count());
+
+  return stats.misses == (long long)files.size() && assets.Count() == 0 ? 0 : EXIT_FAILURE;
+}
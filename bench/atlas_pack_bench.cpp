@@ -0,0 +1,71 @@
+#include "../include/TextureAtlas.hpp"
+#include "../src/random.hpp"
+#include "raylib.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Packs sprites of random sizes with raylib::AtlasPacker, no window or image required, and reports how much of the
+// atlas they cover. Every placement is checked to lie inside the atlas and to keep its padding clear of the others.
+// Compile command:  g++ atlas_pack_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [sprites] [max sprite size] [padding]
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+bool overlap(const ::Rectangle &a, const ::Rectangle &b, int padding)
+{
+  return a.x < b.x + b.width + padding && b.x < a.x + a.width + padding && a.y < b.y + b.height + padding &&
+         b.y < a.y + a.height + padding;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  int count = argc > 1 ? std::atoi(argv[1]) : 500;
+  int maxSize = argc > 2 ? std::atoi(argv[2]) : 128;
+  int padding = argc > 3 ? std::atoi(argv[3]) : 2;
+  if (count < 1 || maxSize < 1 || padding < 0)
+  {
+    std::fprintf(stderr, "usage: %s [sprites] [max sprite size] [padding]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  Random rng{1};
+  std::vector<::Vector2> sizes(count);
+  long long area = 0;
+  for (::Vector2 &size : sizes)
+  {
+    size = ::Vector2{(float)rng.GetRandomValue(1, maxSize), (float)rng.GetRandomValue(1, maxSize)};
+    area += (long long)(size.x * size.y);
+  }
+
+  int width, height;
+  auto start = Clock::now();
+  std::vector<::Rectangle> placed = raylib::AtlasPacker::Pack(sizes, padding, &width, &height);
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  std::printf("%d sprites up to %dx%d, padding %d, packed in %.3f ms\n", count, maxSize, maxSize, padding,
+              seconds * 1e3);
+  std::printf("atlas %dx%d, %.1f%% covered\n", width, height, 100.0 * area / ((double)width * height));
+
+  for (int i = 0; i < count; ++i)
+  {
+    const ::Rectangle &a = placed[i];
+    bool inside = a.x >= 0 && a.y >= 0 && a.x + a.width <= width && a.y + a.height <= height &&
+                  a.width == sizes[i].x && a.height == sizes[i].y;
+    for (int j = i + 1; inside && j < count; ++j)
+    {
+      inside = !overlap(a, placed[j], padding);
+    }
+    if (!inside)
+    {
+      std::printf("MISMATCH: sprite %d at %.0f,%.0f %.0fx%.0f\n", i, a.x, a.y, a.width, a.height);
+      return EXIT_FAILURE;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,83 @@
+#ifndef BENCH_UTIL_HPP_
+#define BENCH_UTIL_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// Timing and checking for the benchmarks that race a reference loop (raymath, or one call per element) against the
+// batch or SIMD version of it, each writing its results into an array of its own.
+namespace bench
+{
+using Clock = std::chrono::steady_clock;
+
+inline double elapsedNs(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// Nanoseconds per item of rounds calls of run, each over count items
+template <typename Run>
+double nsPerItem(int rounds, size_t count, Run run)
+{
+  auto start = Clock::now();
+  for (int r = 0; r < rounds; ++r)
+  {
+    run();
+  }
+  return elapsedNs(start) / rounds / count;
+}
+
+// The names compare() prints for its two sides and for what count counts
+struct Sides
+{
+  const char *reference;
+  const char *candidate;
+  const char *unit;
+};
+
+// How far a float is off, relative to the larger of 1 and the expected value, infinite for NaN
+inline float difference(float expected, float actual)
+{
+  float error = fabsf(expected - actual) / std::max(1.0f, fabsf(expected));
+  return std::isnan(error) ? INFINITY : error;
+}
+
+// Anything else has to match byte for byte
+template <typename T>
+float difference(const T &expected, const T &actual)
+{
+  return std::memcmp(&expected, &actual, sizeof(T)) == 0 ? 0.0f : INFINITY;
+}
+
+// Time rounds calls of reference, writing into expected, and of candidate, writing into actual, over count items each,
+// then check that the two agree to within tolerance
+template <typename T, typename Reference, typename Candidate>
+bool compare(const char *name, const Sides &sides, int rounds, size_t count, float tolerance,
+             const std::vector<T> &expected, const std::vector<T> &actual, Reference reference, Candidate candidate)
+{
+  double referenceNs = nsPerItem(rounds, count, reference);
+  double candidateNs = nsPerItem(rounds, count, candidate);
+
+  float worst = 0;
+  for (size_t i = 0; i < expected.size(); ++i)
+  {
+    worst = std::max(worst, difference(expected[i], actual[i]));
+  }
+
+  std::printf("%-16s %s %7.3f ns/%s  %s %7.3f ns/%s  x%5.2f  [max error %.2g]\n", name, sides.reference, referenceNs,
+              sides.unit, sides.candidate, candidateNs, sides.unit, referenceNs / candidateNs, worst);
+  if (worst > tolerance)
+  {
+    std::printf("MISMATCH in %s\n", name);
+    return false;
+  }
+  return true;
+}
+} // namespace bench
+
+#endif
@@ -0,0 +1,152 @@
+#include "../src/brick_field.hpp"
+#include "../src/random.hpp"
+#include "../src/swept_collision.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Bounces an arkanoid ball through a wall of any size, sweeping it against the bricks it could reach each tick
+// and knocking down whatever it hits, no window required. The ball starts in the middle of the wall and digs its
+// way around, and the walls of the wall itself bounce it back.
+//   grid: only the bricks under the box swept by the ball are tested, as arkanoid does
+//   scan: every standing brick is tested every tick, to show how that grows with the wall
+// Compile command:  g++ brick_field_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [columns] [rows] [ticks] [grid|scan]
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+const float BRICK_WIDTH = 88, BRICK_HEIGHT = 46;
+const float BALL_RADIUS = 12;
+const float BALL_SPEED = 30;
+const int MAX_BOUNCES_PER_TICK = 8;
+
+struct Ball
+{
+  ::Vector2 position;
+  ::Vector2 speed;
+};
+
+// One tick of ball movement, returns the number of bricks tested
+long long moveBall(Ball &ball, BrickField &bricks, bool scan)
+{
+  ::Rectangle bounds{0, 0, bricks.Columns() * BRICK_WIDTH, bricks.Rows() * BRICK_HEIGHT};
+  const ::Rectangle walls[4] = {
+      {bounds.x - bounds.width, bounds.y, bounds.width, bounds.height},
+      {bounds.x + bounds.width, bounds.y, bounds.width, bounds.height},
+      {bounds.x, bounds.y - bounds.height, bounds.width, bounds.height},
+      {bounds.x, bounds.y + bounds.height, bounds.width, bounds.height},
+  };
+
+  long long tested = 0;
+  float remaining = 1.0f;
+  for (int bounce = 0; bounce < MAX_BOUNCES_PER_TICK && remaining > 0; ++bounce)
+  {
+    ::Vector2 motion{ball.speed.x * remaining, ball.speed.y * remaining};
+
+    SweepHit first;
+    int hitColumn = -1, hitRow = -1;
+    auto consider = [&](const ::Rectangle &rectangle) {
+      SweepHit hit = SweepCircleRec(ball.position, BALL_RADIUS, motion, rectangle);
+      if (hit.hit && hit.time < first.time)
+      {
+        first = hit;
+        return true;
+      }
+      return false;
+    };
+    auto considerBrick = [&](int column, int row) {
+      ++tested;
+      if (consider(bricks.BrickRectangle(column, row)))
+      {
+        hitColumn = column;
+        hitRow = row;
+      }
+    };
+
+    for (const ::Rectangle &wall : walls)
+    {
+      if (consider(wall))
+      {
+        hitColumn = -1;
+      }
+    }
+
+    if (scan)
+    {
+      bricks.ForEachLive(bounds, considerBrick);
+    }
+    else
+    {
+      ::Rectangle swept{std::fmin(ball.position.x, ball.position.x + motion.x) - BALL_RADIUS,
+                        std::fmin(ball.position.y, ball.position.y + motion.y) - BALL_RADIUS,
+                        std::fabs(motion.x) + BALL_RADIUS * 2, std::fabs(motion.y) + BALL_RADIUS * 2};
+      bricks.ForEachLive(swept, considerBrick);
+    }
+
+    if (!first.hit)
+    {
+      ball.position.x += motion.x;
+      ball.position.y += motion.y;
+      break;
+    }
+
+    ball.position.x += motion.x * first.time;
+    ball.position.y += motion.y * first.time;
+    remaining *= 1.0f - first.time;
+    ball.speed = Reflect(ball.speed, first.normal);
+
+    if (hitColumn >= 0)
+    {
+      bricks.Clear(hitColumn, hitRow);
+    }
+  }
+  return tested;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  int columns = argc > 1 ? std::atoi(argv[1]) : 10000;
+  int rows = argc > 2 ? std::atoi(argv[2]) : 10000;
+  int ticks = argc > 3 ? std::atoi(argv[3]) : 1000000;
+  bool scan = argc > 4 && std::strcmp(argv[4], "scan") == 0;
+  if (columns < 1 || rows < 1 || ticks < 1)
+  {
+    std::fprintf(stderr, "usage: %s [columns] [rows] [ticks] [grid|scan]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  auto buildStart = Clock::now();
+  BrickField bricks{columns, rows, ::Vector2{0, 0}, ::Vector2{BRICK_WIDTH, BRICK_HEIGHT}};
+  double buildSeconds = std::chrono::duration<double>(Clock::now() - buildStart).count();
+
+  // Clear a pocket for the ball and send it off at a random angle
+  Random rng{1};
+  float angle = rng.GetRandomValue(0, 359) * 3.14159265f / 180.0f;
+  Ball ball{::Vector2{(columns / 2 + 0.5f) * BRICK_WIDTH, (rows / 2 + 0.5f) * BRICK_HEIGHT},
+            ::Vector2{std::cos(angle) * BALL_SPEED, std::sin(angle) * BALL_SPEED}};
+  bricks.Clear(columns / 2, rows / 2);
+  long long standing = bricks.LiveCount();
+
+  long long tested = 0;
+  auto start = Clock::now();
+  for (int t = 0; t < ticks; ++t)
+  {
+    tested += moveBall(ball, bricks, scan);
+  }
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  std::printf("%dx%d wall (%lld bricks, built in %.3f s), %s lookup\n", columns, rows, (long long)columns * rows,
+              buildSeconds, scan ? "scan" : "grid");
+  std::printf("%d ticks in %.3f s: %.0f ticks/s, %.1f ns/tick\n", ticks, seconds, ticks / seconds,
+              seconds * 1e9 / ticks);
+  std::printf("bricks tested per tick %.2f, knocked down %lld, standing %lld\n", (double)tested / ticks,
+              standing - bricks.LiveCount(), bricks.LiveCount());
+
+  return 0;
+}
@@ -0,0 +1,127 @@
+#include "../include/ColorBatch.hpp"
+#include "../src/random.hpp"
+#include "bench_util.hpp"
+#include "raylib.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Runs each raylib::ColorBatch kernel over an array of pixels one call per pixel, which only ever takes its scalar
+// reference loop, and in one call, which takes the SIMD loop, and checks that both write the same bytes. The first
+// 65536 pixels hold every (channel, alpha) pair, so AlphaPremultiply() is checked exhaustively. Then checks that
+// FromHSV(ToHSV(color)) gives every color back to within 1 per channel.
+// Build with -march=native to get the AVX2 path where the CPU has it, the default x86-64 target uses SSE2.
+// Compile command:  g++ color_batch_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [pixels] [rounds]
+
+namespace
+{
+constexpr ::Color TINT{250, 128, 33, 200};
+
+// Time rounds runs of kernel(out, first, n) pixel by pixel into expected and over everything into actual, then
+// compare the two byte for byte
+template <typename T, typename Kernel>
+bool compare(const char *name, int rounds, std::vector<T> &expected, std::vector<T> &actual, Kernel kernel)
+{
+  size_t count = expected.size();
+  return bench::compare(
+      name, {"scalar", "batch", "pixel"}, rounds, count, 0.0f, expected, actual,
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          kernel(expected.data(), i, 1);
+        }
+      },
+      [&]() { kernel(actual.data(), 0, count); });
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  long long pixels = argc > 1 ? std::atoll(argv[1]) : 1048579;
+  int rounds = argc > 2 ? std::atoi(argv[2]) : 50;
+  if (pixels < 65536 || pixels > 0x7fffffff || rounds < 1)
+  {
+    std::fprintf(stderr, "usage: %s [pixels, at least 65536] [rounds]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  size_t count = (size_t)pixels;
+
+  Random rng{1};
+  std::vector<int> bytes(4 * count);
+  rng.Fill(bytes.data(), bytes.size(), 0, 255);
+  std::vector<::Color> colors(count), other(count);
+  std::vector<::Vector3> hsv(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    colors[i] = ::Color{(unsigned char)bytes[4 * i], (unsigned char)bytes[4 * i + 1], (unsigned char)bytes[4 * i + 2],
+                        (unsigned char)bytes[4 * i + 3]};
+    other[i] = ::Color{colors[i].b, colors[i].a, colors[i].r, colors[i].g};
+    // Hues past both ends of the circle, saturations and values a little out of range
+    hsv[i] = ::Vector3{(bytes[4 * i] * 256 + bytes[4 * i + 1]) / 65536.0f * 1440.0f - 540.0f,
+                       bytes[4 * i + 2] / 230.0f - 0.05f, bytes[4 * i + 3] / 230.0f - 0.05f};
+  }
+  for (size_t i = 0; i < 65536; ++i)
+  {
+    unsigned char channel = (unsigned char)(i & 0xff);
+    colors[i] = ::Color{channel, (unsigned char)(255 - channel), channel, (unsigned char)(i >> 8)};
+  }
+
+  std::printf("%lld pixels, %d rounds, %s\n", pixels, rounds,
+#if defined(__AVX2__)
+              "AVX2"
+#elif defined(__SSE2__)
+              "SSE2"
+#elif defined(RAYLIB_CPP_SIMD)
+              "NEON"
+#else
+              "scalar"
+#endif
+  );
+
+  std::vector<::Color> expected(count), actual(count);
+  std::vector<::Vector3> expectedHsv(count), actualHsv(count);
+  using namespace raylib;
+  bool ok = true;
+  ok &= compare("Tint", rounds, expected, actual, [&](::Color *out, size_t first, size_t n) {
+    ColorBatch::Tint(&colors[first], TINT, out + first, n);
+  });
+  ok &= compare("Fade", rounds, expected, actual, [&](::Color *out, size_t first, size_t n) {
+    ColorBatch::Fade(&colors[first], 0.37f, out + first, n);
+  });
+  ok &= compare("AlphaPremultiply", rounds, expected, actual, [&](::Color *out, size_t first, size_t n) {
+    ColorBatch::AlphaPremultiply(&colors[first], out + first, n);
+  });
+  ok &= compare("Grayscale", rounds, expected, actual, [&](::Color *out, size_t first, size_t n) {
+    ColorBatch::Grayscale(&colors[first], out + first, n);
+  });
+  ok &= compare("AlphaBlend", rounds, expected, actual, [&](::Color *out, size_t first, size_t n) {
+    ColorBatch::AlphaBlend(&other[first], &colors[first], out + first, n);
+  });
+  ok &= compare("ToHSV", rounds, expectedHsv, actualHsv, [&](::Vector3 *out, size_t first, size_t n) {
+    ColorBatch::ToHSV(&colors[first], out + first, n);
+  });
+  ok &= compare("FromHSV", rounds, expected, actual, [&](::Color *out, size_t first, size_t n) {
+    ColorBatch::FromHSV(&hsv[first], out + first, n);
+  });
+
+  // Round trip, alpha aside
+  ColorBatch::ToHSV(colors.data(), actualHsv.data(), count);
+  ColorBatch::FromHSV(actualHsv.data(), actual.data(), count);
+  int worst = 0;
+  for (size_t i = 0; i < count; ++i)
+  {
+    worst = std::max({worst, std::abs(colors[i].r - actual[i].r), std::abs(colors[i].g - actual[i].g),
+                      std::abs(colors[i].b - actual[i].b)});
+  }
+  std::printf("HSV round trip   max error %d\n", worst);
+  if (worst > 1)
+  {
+    std::printf("MISMATCH in the HSV round trip\n");
+    ok = false;
+  }
+
+  return ok ? 0 : EXIT_FAILURE;
+}
@@ -0,0 +1,182 @@
+#include "../src/entity_pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// Compares the old array-of-structs Enemy layout with EntityPool on the per-tick enemy passes:
+// movement, offscreen respawn and a brute-force collision scan against a handful of bullets.
+// Compile command:  g++ entity_layout_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+
+namespace
+{
+const int SCREEN_WIDTH = 1200;
+const int SCREEN_HEIGHT = 700;
+const int ENEMY_WIDTH = 45;
+const int ENEMY_HEIGHT = 35;
+const int NUM_QUERIES = 16;
+const long long WORK_PER_RUN = 100000000; // entity-ticks per layout and size
+
+// The layout space_invaders.cpp used before EntityPool
+struct Enemy
+{
+  raylib::Rectangle rec;
+  int speed;
+  bool active;
+  raylib::Color color;
+};
+
+struct Lcg
+{
+  uint32_t state;
+
+  int Next(int min, int max)
+  {
+    state = state * 1664525u + 1013904223u;
+    return min + (int)((state >> 8) % (uint32_t)(max - min + 1));
+  }
+};
+
+struct Result
+{
+  double moveNs = 0, respawnNs = 0, collideNs = 0;
+  long long checksum = 0;
+};
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedNs(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+std::vector<::Rectangle> makeQueries()
+{
+  std::vector<::Rectangle> queries;
+  for (int q = 0; q < NUM_QUERIES; ++q)
+  {
+    queries.push_back(::Rectangle{(float)(q * SCREEN_WIDTH / NUM_QUERIES), (float)(q * 37 % SCREEN_HEIGHT), 10, 5});
+  }
+  return queries;
+}
+
+Result runAoS(int count, int ticks)
+{
+  Lcg rng{12345};
+  std::vector<Enemy> enemies(count);
+  for (auto &enemy : enemies)
+  {
+    float x = (float)rng.Next(0, SCREEN_WIDTH * 2);
+    float y = (float)rng.Next(0, SCREEN_HEIGHT - ENEMY_HEIGHT);
+    enemy.rec = raylib::Rectangle{x, y, ENEMY_WIDTH, ENEMY_HEIGHT};
+    enemy.speed = 2;
+    enemy.active = true;
+    enemy.color = ::YELLOW;
+  }
+  auto queries = makeQueries();
+
+  Result result;
+  for (int t = 0; t < ticks; ++t)
+  {
+    auto start = Clock::now();
+    for (auto &enemy : enemies)
+    {
+      if (enemy.active)
+      {
+        enemy.rec.x -= enemy.speed;
+      }
+    }
+    result.moveNs += elapsedNs(start);
+
+    start = Clock::now();
+    for (auto &enemy : enemies)
+    {
+      if (enemy.active && enemy.rec.x + enemy.rec.width < 0)
+      {
+        enemy.rec.x = rng.Next(SCREEN_WIDTH, SCREEN_WIDTH * 2);
+        enemy.rec.y = rng.Next(0, SCREEN_HEIGHT - ENEMY_HEIGHT);
+      }
+    }
+    result.respawnNs += elapsedNs(start);
+
+    start = Clock::now();
+    for (const auto &query : queries)
+    {
+      for (const auto &enemy : enemies)
+      {
+        if (enemy.active && query.x < enemy.rec.x + enemy.rec.width && query.x + query.width > enemy.rec.x &&
+            query.y < enemy.rec.y + enemy.rec.height && query.y + query.height > enemy.rec.y)
+        {
+          ++result.checksum;
+        }
+      }
+    }
+    result.collideNs += elapsedNs(start);
+  }
+  return result;
+}
+
+Result runSoA(int count, int ticks)
+{
+  Lcg rng{12345};
+  EntityPool enemies{count};
+  for (int i = 0; i < count; ++i)
+  {
+    float x = (float)rng.Next(0, SCREEN_WIDTH * 2);
+    float y = (float)rng.Next(0, SCREEN_HEIGHT - ENEMY_HEIGHT);
+    enemies.Acquire(::Rectangle{x, y, ENEMY_WIDTH, ENEMY_HEIGHT}, 2);
+  }
+  auto queries = makeQueries();
+  std::vector<int> scratch;
+
+  Result result;
+  for (int t = 0; t < ticks; ++t)
+  {
+    auto start = Clock::now();
+    enemies.MoveX(-1.0f);
+    result.moveNs += elapsedNs(start);
+
+    start = Clock::now();
+    scratch.clear();
+    enemies.CollectLeftOf(0.0f, scratch);
+    for (int i : scratch)
+    {
+      enemies.x[i] = rng.Next(SCREEN_WIDTH, SCREEN_WIDTH * 2);
+      enemies.y[i] = rng.Next(0, SCREEN_HEIGHT - ENEMY_HEIGHT);
+    }
+    result.respawnNs += elapsedNs(start);
+
+    start = Clock::now();
+    for (const auto &query : queries)
+    {
+      scratch.clear();
+      enemies.CollectOverlapping(query, scratch);
+      result.checksum += (long long)scratch.size();
+    }
+    result.collideNs += elapsedNs(start);
+  }
+  return result;
+}
+
+void report(const char *layout, int count, int ticks, const Result &result)
+{
+  double perEntityTick = (double)count * ticks;
+  std::printf("%-4s %7d entities  move %6.3f  respawn %6.3f  collide(x%d) %6.3f ns/entity  [checksum %lld]\n", layout,
+              count, result.moveNs / perEntityTick, result.respawnNs / perEntityTick, NUM_QUERIES,
+              result.collideNs / perEntityTick, result.checksum);
+}
+} // namespace
+
+int main()
+{
+  for (int count : {50, 5000, 500000})
+  {
+    int ticks = (int)std::max<long long>(1, WORK_PER_RUN / count / NUM_QUERIES);
+    report("AoS", count, ticks, runAoS(count, ticks));
+    report("SoA", count, ticks, runSoA(count, ticks));
+  }
+
+  return 0;
+}
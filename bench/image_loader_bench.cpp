@@ -0,0 +1,107 @@
+#include "../include/ImageLoader.hpp"
+#include "raylib.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <future>
+#include <string>
+#include <vector>
+
+// Decodes every PNG under assets/ one after the other with ::LoadImage, then all at once on a raylib::ImageLoader,
+// and reports the wall time of both. No window is opened: only decoding is timed, not the texture upload.
+// The parallel images are checked against the sequential ones pixel for pixel.
+// Compile command:  g++ image_loader_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [rounds] [workers, 0 for one per hardware thread] [assets directory]
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+double elapsedMs(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+bool sameImage(const ::Image &a, const ::Image &b)
+{
+  if (a.width != b.width || a.height != b.height || a.format != b.format || (a.data == nullptr) != (b.data == nullptr))
+  {
+    return false;
+  }
+  return a.data == nullptr || std::memcmp(a.data, b.data, ::GetPixelDataSize(a.width, a.height, a.format)) == 0;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  int rounds = argc > 1 ? std::atoi(argv[1]) : 5;
+  int workers = argc > 2 ? std::atoi(argv[2]) : 0;
+  std::string directory = argc > 3 ? argv[3] : "../assets";
+  if (rounds < 1 || workers < 0)
+  {
+    std::fprintf(stderr, "usage: %s [rounds] [workers] [assets directory]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  std::vector<std::string> files;
+  for (const auto &entry : std::filesystem::directory_iterator(directory))
+  {
+    if (entry.path().extension() == ".png")
+    {
+      files.push_back(entry.path().string());
+    }
+  }
+  std::sort(files.begin(), files.end());
+
+  ::SetTraceLogLevel(::LOG_WARNING);
+  raylib::ImageLoader loader{workers};
+  std::vector<::Image> sequential(files.size());
+  std::vector<::Image> parallel(files.size());
+  double sequentialMs = 0, parallelMs = 0;
+  bool same = true;
+
+  for (int r = 0; r < rounds; ++r)
+  {
+    auto start = Clock::now();
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+      sequential[i] = ::LoadImage(files[i].c_str());
+    }
+    sequentialMs += elapsedMs(start);
+
+    start = Clock::now();
+    std::vector<std::future<::Image>> decoding;
+    for (const std::string &file : files)
+    {
+      decoding.push_back(loader.Load(file));
+    }
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+      parallel[i] = decoding[i].get();
+    }
+    parallelMs += elapsedMs(start);
+
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+      same &= sameImage(sequential[i], parallel[i]);
+      ::UnloadImage(sequential[i]);
+      ::UnloadImage(parallel[i]);
+    }
+  }
+
+  std::printf("%d images in %s, %d rounds, %d workers\n", (int)files.size(), directory.c_str(), rounds,
+              loader.Workers());
+  std::printf("sequential %.2f ms, parallel %.2f ms per round: %.2fx\n", sequentialMs / rounds, parallelMs / rounds,
+              sequentialMs / parallelMs);
+
+  if (!same)
+  {
+    std::printf("MISMATCH: parallel decoding gave different pixels\n");
+    return EXIT_FAILURE;
+  }
+  return 0;
+}
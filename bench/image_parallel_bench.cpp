@@ -0,0 +1,199 @@
+#include "../include/Image.hpp"
+#include "../include/ThreadPool.hpp"
+#include "../src/random.hpp"
+#include "raylib.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Runs the raylib::Image pixel operations on generated 4K (3840x2160) and 8K (7680x4320) images, once the plain
+// serial way and once split into row bands on a raylib::ThreadPool, and reports the wall time of both. The parallel
+// results are checked against the serial ones: exact for the per-pixel operations, within 1 per channel for Resize,
+// and within 2 levels, half a level on average, for Dither, whose error diffusion starts over on every band.
+// Compile command:  g++ image_parallel_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [rounds] [workers, 0 for one per hardware thread]
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+constexpr ::Color REPLACED{200, 40, 40, 255};
+
+double elapsedMs(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// A noisy gradient, with every 97th pixel REPLACED for ColorReplace() to find
+::Image generate(int width, int height, Random &rng)
+{
+  unsigned char *pixels = (unsigned char *)RL_MALLOC((size_t)width * height * 4);
+  std::vector<int> noise(width);
+  for (int y = 0; y < height; ++y)
+  {
+    rng.Fill(noise.data(), width, -24, 24);
+    for (int x = 0; x < width; ++x)
+    {
+      unsigned char *pixel = pixels + ((size_t)y * width + x) * 4;
+      if (((size_t)y * width + x) % 97 == 0)
+      {
+        std::memcpy(pixel, &REPLACED, 4);
+        continue;
+      }
+      pixel[0] = (unsigned char)std::clamp(x * 255 / width + noise[x], 0, 255);
+      pixel[1] = (unsigned char)std::clamp(y * 255 / height + noise[x], 0, 255);
+      pixel[2] = (unsigned char)std::clamp(128 + noise[x] * 4, 0, 255);
+      pixel[3] = (unsigned char)std::clamp(255 - (x + y) % 256 + noise[x], 0, 255);
+    }
+  }
+  return ::Image{pixels, width, height, 1, UNCOMPRESSED_R8G8B8A8};
+}
+
+::Image copyOf(const ::Image &image)
+{
+  ::Image copy = image;
+  int size = ::GetPixelDataSize(image.width, image.height, image.format);
+  copy.data = RL_MALLOC(size);
+  std::memcpy(copy.data, image.data, size);
+  return copy;
+}
+
+// The channel values of every pixel, unpacked from 16 bit formats so Dither() results compare level by level
+std::vector<int> channels(const ::Image &image)
+{
+  size_t pixels = (size_t)image.width * image.height;
+  std::vector<int> values;
+  if (image.format == UNCOMPRESSED_R5G6B5)
+  {
+    const unsigned short *packed = (const unsigned short *)image.data;
+    for (size_t i = 0; i < pixels; ++i)
+    {
+      values.insert(values.end(), {packed[i] >> 11, (packed[i] >> 5) & 0x3f, packed[i] & 0x1f});
+    }
+    return values;
+  }
+  const unsigned char *bytes = (const unsigned char *)image.data;
+  values.assign(bytes, bytes + ::GetPixelDataSize(image.width, image.height, image.format));
+  return values;
+}
+
+// Time rounds runs of the serial and of the parallel operation, each on a fresh copy of source, then check the last
+// results against each other: no channel more than maxError apart, and on average at most meanError
+template <typename Serial, typename Parallel>
+bool compare(const char *name, int rounds, const ::Image &source, int maxError, double meanError, Serial serial,
+             Parallel parallel)
+{
+  double serialMs = 0, parallelMs = 0;
+  int worst = 0;
+  double mean = 0;
+  bool sameShape = true;
+  for (int r = 0; r < rounds; ++r)
+  {
+    raylib::Image expected{copyOf(source)};
+    raylib::Image actual{copyOf(source)};
+
+    auto start = Clock::now();
+    serial(expected);
+    serialMs += elapsedMs(start);
+
+    start = Clock::now();
+    parallel(actual);
+    parallelMs += elapsedMs(start);
+
+    if (r == rounds - 1)
+    {
+      sameShape = expected.width == actual.width && expected.height == actual.height &&
+                  expected.format == actual.format && expected.mipmaps == actual.mipmaps;
+      if (sameShape)
+      {
+        std::vector<int> a = channels(expected), b = channels(actual);
+        long long total = 0;
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+          int error = std::abs(a[i] - b[i]);
+          worst = std::max(worst, error);
+          total += error;
+        }
+        mean = a.empty() ? 0 : (double)total / a.size();
+      }
+    }
+  }
+  serialMs /= rounds;
+  parallelMs /= rounds;
+
+  std::printf("  %-16s serial %8.2f ms  parallel %7.2f ms  x%5.2f  [max diff %d, mean %.3f]\n", name, serialMs,
+              parallelMs, serialMs / parallelMs, worst, mean);
+  if (!sameShape || worst > maxError || mean > meanError)
+  {
+    std::printf("MISMATCH in %s\n", name);
+    return false;
+  }
+  return true;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  int rounds = argc > 1 ? std::atoi(argv[1]) : 3;
+  int workers = argc > 2 ? std::atoi(argv[2]) : 0;
+  if (rounds < 1 || workers < 0)
+  {
+    std::fprintf(stderr, "usage: %s [rounds] [workers]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  ::SetTraceLogLevel(::LOG_WARNING);
+  raylib::ThreadPool pool{workers};
+  Random rng{1};
+
+  struct Size
+  {
+    const char *name;
+    int width, height;
+  };
+  bool ok = true;
+  for (Size size : {Size{"4K", 3840, 2160}, Size{"8K", 7680, 4320}})
+  {
+    ::Image source = generate(size.width, size.height, rng);
+    std::printf("%s %dx%d, %d rounds, %d workers and the calling thread\n", size.name, size.width, size.height, rounds,
+                pool.Workers());
+
+    ok &= compare(
+        "ColorTint", rounds, source, 0, 0, [](raylib::Image &image) { image.ColorTint(REPLACED); },
+        [&](raylib::Image &image) { image.ColorTint(REPLACED, pool); });
+    ok &= compare(
+        "ColorGrayscale", rounds, source, 0, 0, [](raylib::Image &image) { image.ColorGrayscale(); },
+        [&](raylib::Image &image) { image.ColorGrayscale(pool); });
+    ok &= compare(
+        "ColorContrast", rounds, source, 0, 0, [](raylib::Image &image) { image.ColorContrast(40); },
+        [&](raylib::Image &image) { image.ColorContrast(40, pool); });
+    ok &= compare(
+        "ColorBrightness", rounds, source, 0, 0, [](raylib::Image &image) { image.ColorBrightness(-30); },
+        [&](raylib::Image &image) { image.ColorBrightness(-30, pool); });
+    ok &= compare(
+        "ColorReplace", rounds, source, 0, 0, [](raylib::Image &image) { image.ColorReplace(REPLACED, BLANK); },
+        [&](raylib::Image &image) { image.ColorReplace(REPLACED, BLANK, pool); });
+    ok &= compare(
+        "AlphaPremultiply", rounds, source, 0, 0, [](raylib::Image &image) { image.AlphaPremultiply(); },
+        [&](raylib::Image &image) { image.AlphaPremultiply(pool); });
+    ok &= compare(
+        "Dither", rounds, source, 2, 0.5, [](raylib::Image &image) { image.Dither(5, 6, 5, 0); },
+        [&](raylib::Image &image) { image.Dither(5, 6, 5, 0, pool); });
+    ok &= compare(
+        "Resize half", rounds, source, 1, 1,
+        [&](raylib::Image &image) { image.Resize(size.width / 2, size.height / 2); },
+        [&](raylib::Image &image) { image.Resize(size.width / 2, size.height / 2, pool); });
+    ok &= compare(
+        "Resize 3/4", rounds, source, 1, 1,
+        [&](raylib::Image &image) { image.Resize(size.width * 3 / 4, size.height * 3 / 4); },
+        [&](raylib::Image &image) { image.Resize(size.width * 3 / 4, size.height * 3 / 4, pool); });
+
+    ::UnloadImage(source);
+  }
+
+  return ok ? 0 : EXIT_FAILURE;
+}
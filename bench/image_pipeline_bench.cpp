@@ -0,0 +1,163 @@
+#include "../include/Image.hpp"
+#include "../include/ImagePipeline.hpp"
+#include "../src/random.hpp"
+#include "raylib.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Runs chains of raylib::Image operations on a generated 4K (3840x2160) image, once as chained Image method calls,
+// one pass over the pixels each, and once recorded in a raylib::ImagePipeline and run fused, and reports the wall
+// time of both. The fused results must match the chained ones pixel for pixel.
+// Compile command:  g++ image_pipeline_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [rounds]
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+constexpr ::Color REPLACED{200, 40, 40, 255};
+
+double elapsedMs(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// A noisy gradient, with every 97th pixel REPLACED for ColorReplace() to find
+::Image generate(int width, int height, Random &rng)
+{
+  unsigned char *pixels = (unsigned char *)RL_MALLOC((size_t)width * height * 4);
+  std::vector<int> noise(width);
+  for (int y = 0; y < height; ++y)
+  {
+    rng.Fill(noise.data(), width, -24, 24);
+    for (int x = 0; x < width; ++x)
+    {
+      unsigned char *pixel = pixels + ((size_t)y * width + x) * 4;
+      if (((size_t)y * width + x) % 97 == 0)
+      {
+        std::memcpy(pixel, &REPLACED, 4);
+        continue;
+      }
+      pixel[0] = (unsigned char)std::clamp(x * 255 / width + noise[x], 0, 255);
+      pixel[1] = (unsigned char)std::clamp(y * 255 / height + noise[x], 0, 255);
+      pixel[2] = (unsigned char)std::clamp(128 + noise[x] * 4, 0, 255);
+      pixel[3] = (unsigned char)std::clamp(255 - (x + y) % 256 + noise[x], 0, 255);
+    }
+  }
+  return ::Image{pixels, width, height, 1, UNCOMPRESSED_R8G8B8A8};
+}
+
+::Image copyOf(const ::Image &image)
+{
+  ::Image copy = image;
+  int size = ::GetPixelDataSize(image.width, image.height, image.format);
+  copy.data = RL_MALLOC(size);
+  std::memcpy(copy.data, image.data, size);
+  return copy;
+}
+
+// Time rounds runs of the chained calls and of the pipeline, each on a fresh copy of source, then check the last
+// results are the same image
+template <typename Chain>
+bool compare(const char *name, int rounds, const ::Image &source, Chain chain, const raylib::ImagePipeline &pipeline)
+{
+  double chainMs = 0, pipelineMs = 0;
+  bool same = true;
+  for (int r = 0; r < rounds; ++r)
+  {
+    raylib::Image expected{copyOf(source)};
+    raylib::Image actual{copyOf(source)};
+
+    auto start = Clock::now();
+    chain(expected);
+    chainMs += elapsedMs(start);
+
+    start = Clock::now();
+    pipeline.Run(&actual);
+    pipelineMs += elapsedMs(start);
+
+    if (r == rounds - 1)
+    {
+      same = expected.width == actual.width && expected.height == actual.height &&
+             expected.format == actual.format && expected.mipmaps == actual.mipmaps &&
+             std::memcmp(expected.data, actual.data,
+                         ::GetPixelDataSize(expected.width, expected.height, expected.format)) == 0;
+    }
+  }
+  chainMs /= rounds;
+  pipelineMs /= rounds;
+
+  std::printf("  %-28s chained %8.2f ms  fused %7.2f ms  x%5.2f\n", name, chainMs, pipelineMs, chainMs / pipelineMs);
+  if (!same)
+  {
+    std::printf("MISMATCH in %s\n", name);
+    return false;
+  }
+  return true;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  int rounds = argc > 1 ? std::atoi(argv[1]) : 3;
+  if (rounds < 1)
+  {
+    std::fprintf(stderr, "usage: %s [rounds]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  ::SetTraceLogLevel(::LOG_WARNING);
+  Random rng{1};
+  ::Image source = generate(3840, 2160, rng);
+  ::Rectangle crop{-20.5f, 100, 3000.7f, 4000};
+  ::Color tint{250, 128, 33, 200};
+  std::printf("4K %dx%d, %d rounds\n", source.width, source.height, rounds);
+
+  bool ok = true;
+  raylib::ImagePipeline pipeline;
+  pipeline.Crop(crop).ResizeNN(1920, 1080).ColorTint(tint).FlipHorizontal();
+  ok &= compare(
+      "Crop ResizeNN Tint Flip", rounds, source,
+      [&](raylib::Image &image) { image.Crop(crop).ResizeNN(1920, 1080).ColorTint(tint).FlipHorizontal(); },
+      pipeline);
+
+  pipeline.Clear();
+  pipeline.Crop(crop).Resize(1920, 1080).ColorTint(tint).FlipHorizontal();
+  ok &= compare(
+      "Crop Resize Tint Flip", rounds, source,
+      [&](raylib::Image &image) { image.Crop(crop).Resize(1920, 1080).ColorTint(tint).FlipHorizontal(); }, pipeline);
+
+  pipeline.Clear();
+  pipeline.RotateCW().ColorContrast(40).ColorBrightness(-30).AlphaPremultiply().ColorReplace(REPLACED, BLANK);
+  pipeline.FlipVertical();
+  ok &= compare(
+      "Rotate Color Premultiply", rounds, source,
+      [&](raylib::Image &image) {
+        image.RotateCW().ColorContrast(40).ColorBrightness(-30).AlphaPremultiply().ColorReplace(REPLACED, BLANK);
+        image.FlipVertical();
+      },
+      pipeline);
+
+  pipeline.Clear();
+  pipeline.ColorInvert().RotateCCW().ResizeNN(2000, 3000).Crop(crop).ColorTint(tint).RotateCW();
+  ok &= compare(
+      "Invert Rotate ResizeNN Crop", rounds, source,
+      [&](raylib::Image &image) {
+        image.ColorInvert().RotateCCW().ResizeNN(2000, 3000).Crop(crop).ColorTint(tint).RotateCW();
+      },
+      pipeline);
+
+  pipeline.Clear();
+  pipeline.ColorTint(tint).ColorContrast(-25).ColorInvert();
+  ok &= compare(
+      "Tint Contrast Invert", rounds, source,
+      [&](raylib::Image &image) { image.ColorTint(tint).ColorContrast(-25).ColorInvert(); }, pipeline);
+
+  ::UnloadImage(source);
+  return ok ? 0 : EXIT_FAILURE;
+}
@@ -0,0 +1,165 @@
+#include "../include/Color.hpp"
+#include "../include/Matrix.hpp"
+#include "../include/Rectangle.hpp"
+#include "../include/Vector2.hpp"
+#include "../include/Vector3.hpp"
+#include "../include/Vector4.hpp"
+#include "../src/random.hpp"
+#include "bench_util.hpp"
+#include "raylib.h"
+#include "raymath.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+
+// The static_asserts below check at compile time that the math wrappers are trivially copyable and that their
+// arithmetic folds to constants, so this file only builds if that holds. At run time it times chains of wrapper
+// operators against the nested raymath calls they replace, which should be even, and checks that both agree.
+// Compile command:  g++ math_constexpr_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [vectors] [rounds]
+
+static_assert(std::is_trivially_copyable<raylib::Vector2>::value, "Vector2 must copy like ::Vector2");
+static_assert(std::is_trivially_copyable<raylib::Vector3>::value, "Vector3 must copy like ::Vector3");
+static_assert(std::is_trivially_copyable<raylib::Vector4>::value, "Vector4 must copy like ::Vector4");
+static_assert(std::is_trivially_copyable<raylib::Matrix>::value, "Matrix must copy like ::Matrix");
+static_assert(std::is_trivially_copyable<raylib::Color>::value, "Color must copy like ::Color");
+static_assert(std::is_trivially_copyable<raylib::Rectangle>::value, "Rectangle must copy like ::Rectangle");
+
+namespace
+{
+// Game constants, all computed by the compiler
+constexpr raylib::Vector2 START{3, 4};
+constexpr raylib::Vector2 VELOCITY{-1, 0.5f};
+constexpr raylib::Color TINT{255, 128, 0};
+constexpr raylib::Rectangle PADDLE{100, 600, 120, 20};
+// Scale by (2, 3, 4), then move by (1, 2, 3), without a (non-constexpr) matrix multiply
+constexpr raylib::Matrix MODEL =
+    raylib::Matrix::Scale(2, 3, 4).Add(raylib::Matrix::Translate(1, 2, 3)).Subtract(raylib::Matrix::Identity());
+
+constexpr raylib::Vector2 afterSteps(int steps)
+{
+  raylib::Vector2 position = START;
+  for (int i = 0; i < steps; ++i)
+  {
+    position += VELOCITY;
+  }
+  return position;
+}
+
+static_assert(START + VELOCITY * 2.0f == raylib::Vector2{1, 5}, "Vector2 arithmetic");
+static_assert(-START / 2.0f == raylib::Vector2{-1.5f, -2}, "Vector2 negate and divide");
+static_assert(START.DotProduct(VELOCITY) == -1, "Vector2 dot product");
+static_assert(START.Lerp(raylib::Vector2{5, 8}, 0.5f) == raylib::Vector2{4, 6}, "Vector2 lerp");
+static_assert(afterSteps(4) == raylib::Vector2{-1, 6}, "Vector2 compound assignment");
+static_assert(raylib::Vector2::One() - raylib::Vector2::Zero() != raylib::Vector2::Zero(), "Vector2 constants");
+
+static_assert(raylib::Vector3{1, 0, 0}.CrossProduct(raylib::Vector3{0, 1, 0}) == raylib::Vector3{0, 0, 1},
+              "Vector3 cross product");
+static_assert(raylib::Vector3{1, -1, 0}.Reflect(raylib::Vector3{0, 1, 0}) == raylib::Vector3{1, 1, 0},
+              "Vector3 reflect");
+static_assert(raylib::Vector3{1, 1, 1}.Transform(MODEL) == raylib::Vector3{3, 5, 7}, "Vector3 transform");
+static_assert(raylib::Vector3{2, 4, 6} / raylib::Vector3{2, 4, 6} == raylib::Vector3::One(), "Vector3 divide");
+
+static_assert(raylib::Vector4{1, 0, 0, 0} * raylib::Vector4{0, 1, 0, 0} == raylib::Vector4{0, 0, 1, 0},
+              "Quaternion product, i * j = k");
+static_assert(raylib::Vector4{1, 2, 3, 4} * raylib::Vector4::Identity() == raylib::Vector4{1, 2, 3, 4},
+              "Quaternion identity");
+static_assert(raylib::Vector4{1, 1, 1, 1}.Transform(MODEL) == raylib::Vector4{3, 5, 7, 1}, "Vector4 transform");
+
+static_assert(raylib::Matrix::Identity().Trace() == 4, "Matrix trace");
+static_assert(MODEL.Transpose().Transpose() == MODEL, "Matrix transpose");
+static_assert(MODEL.Transpose().m3 == 1 && MODEL.m12 == 1, "Matrix transpose moves the translation");
+static_assert(MODEL - MODEL == raylib::Matrix{}, "Matrix subtract");
+
+static_assert(TINT == raylib::Color{255, 128, 0, 255} && TINT != raylib::Color{}, "Color equality");
+static_assert(PADDLE.width == 120 && PADDLE.y == 600, "Rectangle constructor");
+
+float randomFloat(Random &rng)
+{
+  return rng.GetRandomValue(-100000, 100000) / 100.0f;
+}
+
+const bench::Sides SIDES{"raymath", "wrapper", "vector"};
+} // namespace
+
+int main(int argc, char **argv)
+{
+  long long vectors = argc > 1 ? std::atoll(argv[1]) : 4099;
+  int rounds = argc > 2 ? std::atoi(argv[2]) : 20000;
+  if (vectors < 1 || rounds < 1)
+  {
+    std::fprintf(stderr, "usage: %s [vectors] [rounds]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  size_t count = (size_t)vectors;
+
+  Random rng{1};
+  std::vector<raylib::Vector2> positions(count), velocities(count);
+  std::vector<raylib::Vector3> a(count), b(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    positions[i] = raylib::Vector2{randomFloat(rng), randomFloat(rng)};
+    velocities[i] = raylib::Vector2{randomFloat(rng), randomFloat(rng)};
+    a[i] = raylib::Vector3{randomFloat(rng), randomFloat(rng), randomFloat(rng)};
+    b[i] = raylib::Vector3{randomFloat(rng), randomFloat(rng), randomFloat(rng)};
+  }
+  const float dt = 1.0f / 120;
+  constexpr raylib::Vector3 target{10, -20, 30};
+
+  std::vector<float> expected(3 * count), actual(3 * count);
+  ::Vector2 *expected2 = reinterpret_cast<::Vector2 *>(expected.data());
+  raylib::Vector2 *actual2 = reinterpret_cast<raylib::Vector2 *>(actual.data());
+  ::Vector3 *expected3 = reinterpret_cast<::Vector3 *>(expected.data());
+  raylib::Vector3 *actual3 = reinterpret_cast<raylib::Vector3 *>(actual.data());
+
+  std::printf("%lld vectors, %d rounds\n", vectors, rounds);
+
+  bool ok = true;
+  ok &= bench::compare(
+      "Vector2", SIDES, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          expected2[i] = ::Vector2Subtract(::Vector2Add(positions[i], ::Vector2Scale(velocities[i], dt)), START);
+        }
+      },
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          actual2[i] = positions[i] + velocities[i] * dt - START;
+        }
+      });
+  ok &= bench::compare(
+      "Vector3", SIDES, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          expected3[i] = ::Vector3Add(::Vector3Lerp(::Vector3CrossProduct(a[i], b[i]), target, 0.25f),
+                                      ::Vector3Scale(a[i], 2.0f));
+        }
+      },
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          actual3[i] = a[i].CrossProduct(b[i]).Lerp(target, 0.25f) + a[i] * 2.0f;
+        }
+      });
+  ok &= bench::compare(
+      "Transform", SIDES, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          expected3[i] = ::Vector3Transform(a[i], MODEL);
+        }
+      },
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          actual3[i] = a[i].Transform(MODEL);
+        }
+      });
+
+  return ok ? 0 : EXIT_FAILURE;
+}
@@ -0,0 +1,162 @@
+#include "../include/Matrix.hpp"
+#include "../src/random.hpp"
+#include "bench_util.hpp"
+#include "raylib.h"
+#include "raymath.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Times raylib::Matrix's Multiply(), Invert() and batch Transform() against the raymath calls they stand in for
+// (::MatrixMultiply(), ::MatrixInvert(), ::Vector3Transform() and ::QuaternionTransform() loops) on random data, and
+// checks that both agree to within float rounding. Every inverse is also multiplied back to the identity.
+// Build with -march=native to get the AVX2 transforms where the CPU has it, the default x86-64 target uses SSE2.
+// Compile command:  g++ matrix_simd_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [matrices and vectors] [rounds]
+
+namespace
+{
+float randomFloat(Random &rng)
+{
+  return rng.GetRandomValue(-10000, 10000) / 10000.0f;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  long long items = argc > 1 ? std::atoll(argv[1]) : 1027;
+  int rounds = argc > 2 ? std::atoi(argv[2]) : 20000;
+  if (items < 1 || rounds < 1)
+  {
+    std::fprintf(stderr, "usage: %s [matrices and vectors] [rounds]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  size_t count = (size_t)items;
+
+  // Entries in [-1, 1] with 4 added to the diagonal keep every matrix far from singular
+  Random rng{1};
+  std::vector<raylib::Matrix> left(count), right(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    for (raylib::Matrix *matrix : {&left[i], &right[i]})
+    {
+      float *m = &matrix->m0;
+      for (int k = 0; k < 16; ++k)
+      {
+        m[k] = randomFloat(rng) + (k % 5 == 0 ? 4.0f : 0.0f);
+      }
+    }
+  }
+  std::vector<::Vector3> points(count);
+  std::vector<::Vector4> vectors(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    points[i] = ::Vector3{randomFloat(rng) * 100, randomFloat(rng) * 100, randomFloat(rng) * 100};
+    vectors[i] = ::Vector4{randomFloat(rng) * 100, randomFloat(rng) * 100, randomFloat(rng) * 100, randomFloat(rng)};
+  }
+  const raylib::Matrix &transform = left[0];
+
+  std::vector<float> expected(16 * count), actual(16 * count);
+  ::Matrix *expectedMatrices = reinterpret_cast<::Matrix *>(expected.data());
+  raylib::Matrix *actualMatrices = reinterpret_cast<raylib::Matrix *>(actual.data());
+
+  std::printf("%lld matrices and vectors, %d rounds, %s\n", items, rounds,
+#if defined(__AVX2__)
+              "AVX2"
+#elif defined(__SSE2__)
+              "SSE2"
+#elif defined(RAYLIB_CPP_SIMD)
+              "NEON"
+#else
+              "scalar"
+#endif
+  );
+
+  bool ok = true;
+  ok &= bench::compare(
+      "Multiply", {"raymath", "raylib::Matrix", "matrix"}, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          expectedMatrices[i] = ::MatrixMultiply(left[i], right[i]);
+        }
+      },
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          actualMatrices[i] = left[i].Multiply(right[i]);
+        }
+      });
+
+  // A different algorithm from raymath's, so it rounds differently
+  ok &= bench::compare(
+      "Invert", {"raymath", "raylib::Matrix", "matrix"}, rounds, count, 1e-4f, expected, actual,
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          expectedMatrices[i] = ::MatrixInvert(left[i]);
+        }
+      },
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          actualMatrices[i] = left[i].Invert();
+        }
+      });
+  for (size_t i = 0; i < count; ++i)
+  {
+    raylib::Matrix identity = left[i].Multiply(actualMatrices[i]);
+    const float *m = &identity.m0;
+    for (int k = 0; k < 16; ++k)
+    {
+      if (fabsf(m[k] - (k % 5 == 0 ? 1.0f : 0.0f)) > 1e-4f)
+      {
+        std::printf("MISMATCH: matrix %zu times its inverse is off the identity by %g\n", i, m[k]);
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  std::fill(expected.begin(), expected.end(), 0.0f);
+  std::fill(actual.begin(), actual.end(), 0.0f);
+  ::Vector3 *expectedPoints = reinterpret_cast<::Vector3 *>(expected.data());
+  ::Vector3 *actualPoints = reinterpret_cast<::Vector3 *>(actual.data());
+  ok &= bench::compare(
+      "Vector3", {"raymath", "raylib::Matrix", "vector"}, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          expectedPoints[i] = ::Vector3Transform(points[i], transform);
+        }
+      },
+      [&]() { transform.Transform(points.data(), actualPoints, count); });
+
+  // In place gives the same points
+  std::vector<::Vector3> inPlace(points);
+  transform.Transform(inPlace.data(), inPlace.data(), count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (inPlace[i].x != actualPoints[i].x || inPlace[i].y != actualPoints[i].y || inPlace[i].z != actualPoints[i].z)
+    {
+      std::printf("MISMATCH: in-place Transform differs at %zu\n", i);
+      return EXIT_FAILURE;
+    }
+  }
+
+  ::Vector4 *expectedVectors = reinterpret_cast<::Vector4 *>(expected.data());
+  ::Vector4 *actualVectors = reinterpret_cast<::Vector4 *>(actual.data());
+  ok &= bench::compare(
+      "Vector4", {"raymath", "raylib::Matrix", "vector"}, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          expectedVectors[i] = ::QuaternionTransform(vectors[i], transform);
+        }
+      },
+      [&]() { transform.Transform(vectors.data(), actualVectors, count); });
+
+  return ok ? 0 : EXIT_FAILURE;
+}
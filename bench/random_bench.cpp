@@ -0,0 +1,67 @@
+#include "../src/random.hpp"
+#include "raylib.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Draws the same amount of numbers from raylib's ::GetRandomValue, Random::GetRandomValue and Random::Fill.
+// The Random checksums only depend on the seed, so they match across machines and SIMD paths.
+// Compile command:  g++ random_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [count]
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+double elapsedNs(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+void report(const char *name, double ns, long long count, long long checksum)
+{
+  std::printf("%-24s %6.2f ns/value  [checksum %lld]\n", name, ns / count, checksum);
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  long long count = argc > 1 ? std::atoll(argv[1]) : 50000000;
+  const int MIN = 0, MAX = 1000;
+
+  long long checksum = 0;
+  std::srand(1);
+  auto start = Clock::now();
+  for (long long i = 0; i < count; ++i)
+  {
+    checksum += ::GetRandomValue(MIN, MAX);
+  }
+  report("::GetRandomValue", elapsedNs(start), count, checksum);
+
+  Random rng{1};
+  checksum = 0;
+  start = Clock::now();
+  for (long long i = 0; i < count; ++i)
+  {
+    checksum += rng.GetRandomValue(MIN, MAX);
+  }
+  report("Random::GetRandomValue", elapsedNs(start), count, checksum);
+
+  std::vector<int> batch(4096);
+  rng.Seed(1);
+  checksum = 0;
+  start = Clock::now();
+  for (long long i = 0; i < count; i += (long long)batch.size())
+  {
+    rng.Fill(batch.data(), batch.size(), MIN, MAX);
+    for (int value : batch)
+    {
+      checksum += value;
+    }
+  }
+  report("Random::Fill", elapsedNs(start), count, checksum);
+
+  return 0;
+}
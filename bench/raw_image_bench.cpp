@@ -0,0 +1,190 @@
+#include "../include/MappedImage.hpp"
+#include "raylib.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Bakes every PNG under assets/ into a .rawimg file in the output directory, then loads all of them each way a game
+// can at startup and reports the wall time: ::LoadImage() decoding the PNGs, raylib::MappedImage mapping the
+// .rawimg files (reading every byte, so the pages are really touched), and MappedImage::LoadImage() copying them
+// into images of their own. No window is opened, so the texture upload is not timed, and the files are read from a
+// warm page cache. Every loaded image is checked against the decoded PNG in 32 bit RGBA pixel for pixel. First,
+// generated DXT1, DXT5 and ETC2 images with full mipmap chains are written, mapped and copied back byte for byte.
+// Compile command:  g++ raw_image_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [rounds] [assets directory] [output directory]
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+double elapsedMs(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+bool sameImage(const ::Image &a, const ::Image &b)
+{
+  if (a.width != b.width || a.height != b.height || a.format != b.format || a.data == nullptr || b.data == nullptr)
+  {
+    return false;
+  }
+  return std::memcmp(a.data, b.data, ::GetPixelDataSize(a.width, a.height, a.format)) == 0;
+}
+
+// Sums every byte of image, standing in for the upload reading it
+uint64_t touch(const ::Image &image)
+{
+  const unsigned char *bytes = (const unsigned char *)image.data;
+  int size = ::GetPixelDataSize(image.width, image.height, image.format);
+  uint64_t sum = 0;
+  for (int i = 0; i < size; ++i)
+  {
+    sum += bytes[i];
+  }
+  return sum;
+}
+
+// Writes and maps block-compressed images with a full mipmap chain down to 1x1, where raylib rounds the levels under
+// 4x4 up to a whole block, and checks that the payload, the mapping and a copy hold every byte of every level
+bool checkCompressed(const std::filesystem::path &output)
+{
+  bool ok = true;
+  for (int format : {COMPRESSED_DXT1_RGBA, COMPRESSED_DXT5_RGBA, COMPRESSED_ETC2_RGB})
+  {
+    int width = 256, height = 64, mipmaps = 9;
+    size_t size = 0;
+    for (int level = 0; level < mipmaps; ++level)
+    {
+      size += (size_t)::GetPixelDataSize(width >> level > 0 ? width >> level : 1,
+                                         height >> level > 0 ? height >> level : 1, format);
+    }
+    unsigned char *bytes = (unsigned char *)RL_MALLOC(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+      bytes[i] = (unsigned char)(i * 31 + format);
+    }
+    ::Image image{bytes, width, height, mipmaps, format};
+    std::string file = (output / ("compressed" + std::to_string(format) + ".rawimg")).string();
+
+    bool same = raylib::MappedImage::Export(image, file) &&
+                std::filesystem::file_size(file) == raylib::MappedImage::ALIGNMENT + size;
+    raylib::MappedImage mapped{file};
+    ::Image copy = mapped.Copy();
+    same = same && mapped.IsReady() && mapped.GetImage().mipmaps == mipmaps &&
+           std::memcmp(mapped.GetImage().data, bytes, size) == 0 && std::memcmp(copy.data, bytes, size) == 0;
+    if (!same)
+    {
+      std::printf("MISMATCH in the compressed format %d with %d mipmaps\n", format, mipmaps);
+      ok = false;
+    }
+    ::UnloadImage(copy);
+    ::UnloadImage(image);
+  }
+  return ok;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  int rounds = argc > 1 ? std::atoi(argv[1]) : 5;
+  std::string directory = argc > 2 ? argv[2] : "../assets";
+  std::filesystem::path output = argc > 3 ? argv[3] : std::filesystem::temp_directory_path() / "raw_image_bench";
+  if (rounds < 1)
+  {
+    std::fprintf(stderr, "usage: %s [rounds] [assets directory] [output directory]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  std::vector<std::string> files;
+  for (const auto &entry : std::filesystem::directory_iterator(directory))
+  {
+    if (entry.path().extension() == ".png")
+    {
+      files.push_back(entry.path().string());
+    }
+  }
+  std::sort(files.begin(), files.end());
+
+  ::SetTraceLogLevel(::LOG_WARNING);
+  std::filesystem::create_directories(output);
+  bool ok = checkCompressed(output);
+  std::vector<::Image> expected(files.size());
+  std::vector<std::string> rawFiles(files.size());
+  long long pngBytes = 0, rawBytes = 0;
+  for (size_t i = 0; i < files.size(); ++i)
+  {
+    expected[i] = ::LoadImage(files[i].c_str());
+    ::ImageFormat(&expected[i], UNCOMPRESSED_R8G8B8A8);
+    rawFiles[i] = (output / std::filesystem::path(files[i]).stem()).string() + ".rawimg";
+    if (!raylib::MappedImage::Export(expected[i], rawFiles[i]))
+    {
+      std::fprintf(stderr, "Could not write %s\n", rawFiles[i].c_str());
+      return EXIT_FAILURE;
+    }
+    pngBytes += (long long)std::filesystem::file_size(files[i]);
+    rawBytes += (long long)std::filesystem::file_size(rawFiles[i]);
+  }
+
+  std::vector<::Image> decoded(files.size());
+  std::vector<::Image> copied(files.size());
+  double decodeMs = 0, mapMs = 0, copyMs = 0;
+  uint64_t checksum = 0;
+  bool same = true;
+  for (int r = 0; r < rounds; ++r)
+  {
+    auto start = Clock::now();
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+      decoded[i] = ::LoadImage(files[i].c_str());
+    }
+    decodeMs += elapsedMs(start);
+
+    start = Clock::now();
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+      raylib::MappedImage mapped{rawFiles[i]};
+      checksum += touch(mapped.GetImage());
+      same = same && sameImage(mapped.GetImage(), expected[i]);
+    }
+    mapMs += elapsedMs(start);
+
+    start = Clock::now();
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+      copied[i] = raylib::MappedImage::LoadImage(rawFiles[i]);
+    }
+    copyMs += elapsedMs(start);
+
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+      same = same && sameImage(copied[i], expected[i]);
+      ::ImageFormat(&decoded[i], UNCOMPRESSED_R8G8B8A8);
+      same = same && sameImage(decoded[i], expected[i]);
+      ::UnloadImage(decoded[i]);
+      ::UnloadImage(copied[i]);
+    }
+  }
+  for (::Image &image : expected)
+  {
+    ::UnloadImage(image);
+  }
+
+  std::printf("%d images, %lld bytes of PNG, %lld bytes of .rawimg, %d rounds (checksum %llu)\n", (int)files.size(),
+              pngBytes, rawBytes, rounds, (unsigned long long)checksum);
+  std::printf("LoadImage PNG         %8.2f ms\n", decodeMs / rounds);
+  std::printf("MappedImage           %8.2f ms  x%6.2f\n", mapMs / rounds, decodeMs / mapMs);
+  std::printf("MappedImage::LoadImage%8.2f ms  x%6.2f\n", copyMs / rounds, decodeMs / copyMs);
+  if (!same)
+  {
+    std::printf("MISMATCH in the loaded images\n");
+    ok = false;
+  }
+  return ok ? 0 : EXIT_FAILURE;
+}
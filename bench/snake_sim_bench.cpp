@@ -0,0 +1,154 @@
+#include "../src/snake_sim.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+// Runs the snake rules headless on a board of any size, moving every tick, and reports throughput, heap
+// allocations made while stepping and the tick latency distribution. The snake restarts whenever it dies.
+//   greedy: heads for the fruit and avoids squares it can see are taken, so the snake grows long
+//   random: turns at random, so the snake stays short and dies often
+// Compile command:  g++ snake_sim_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [columns] [rows] [ticks] [greedy|random]
+
+namespace
+{
+long long allocations = 0;
+}
+
+void *operator new(std::size_t size)
+{
+  ++allocations;
+  if (void *p = std::malloc(size))
+  {
+    return p;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void *p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+namespace
+{
+using namespace snake;
+using Clock = std::chrono::steady_clock;
+
+const int DIRECTIONS[4][2] = {{1, 0}, {-1, 0}, {0, -1}, {0, 1}};
+
+SnakeInput turnTo(int x, int y)
+{
+  SnakeInput input;
+  input.right = x > 0;
+  input.left = x < 0;
+  input.up = y < 0;
+  input.down = y > 0;
+  return input;
+}
+
+bool isSafe(const SnakeSim &sim, int column, int row)
+{
+  return sim.occupancy.Contains(column, row) && !sim.occupancy.Test(sim.occupancy.CellOf(column, row));
+}
+
+// Among the directions that don't reverse into the neck, prefer a safe one that closes in on the fruit
+SnakeInput greedyAgent(const SnakeSim &sim, Random &)
+{
+  int column = sim.body.Front() % sim.Columns();
+  int row = sim.body.Front() / sim.Columns();
+  int fruitColumn = sim.fruit.cell % sim.Columns();
+  int fruitRow = sim.fruit.cell / sim.Columns();
+
+  int best = -1, bestDistance = 0;
+  for (int d = 0; d < 4; ++d)
+  {
+    int x = DIRECTIONS[d][0], y = DIRECTIONS[d][1];
+    if ((x != 0 && x == -sim.speedX) || (y != 0 && y == -sim.speedY) || !isSafe(sim, column + x, row + y))
+    {
+      continue;
+    }
+    int distance = std::abs(fruitColumn - column - x) + std::abs(fruitRow - row - y);
+    if (best < 0 || distance < bestDistance)
+    {
+      best = d;
+      bestDistance = distance;
+    }
+  }
+
+  SnakeInput input = best < 0 ? SnakeInput{} : turnTo(DIRECTIONS[best][0], DIRECTIONS[best][1]);
+  input.restart = true;
+  return input;
+}
+
+// Turns one time in eight, otherwise keeps going
+SnakeInput randomAgent(const SnakeSim &, Random &agentRng)
+{
+  SnakeInput input;
+  if (agentRng.GetRandomValue(0, 7) == 0)
+  {
+    int d = agentRng.GetRandomValue(0, 3);
+    input = turnTo(DIRECTIONS[d][0], DIRECTIONS[d][1]);
+  }
+  input.restart = true;
+  return input;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  int columns = argc > 1 ? std::atoi(argv[1]) : 256;
+  int rows = argc > 2 ? std::atoi(argv[2]) : 256;
+  int ticks = argc > 3 ? std::atoi(argv[3]) : 2000000;
+  bool greedy = argc <= 4 || std::strcmp(argv[4], "random") != 0;
+  if (columns < 1 || rows < 1 || (long long)columns * rows > 4096 * 4096 || ticks < 1)
+  {
+    std::fprintf(stderr, "boards go from 1x1 up to 4096x4096 squares\n");
+    return EXIT_FAILURE;
+  }
+
+  Random rng{1};
+  Random agentRng{2};
+  SnakeSim sim{columns, rows, rng, 1};
+  auto agent = greedy ? greedyAgent : randomAgent;
+  std::vector<uint32_t> latencies(ticks);
+
+  long long allocationsBefore = allocations;
+  int deaths = 0, longest = 0;
+  auto start = Clock::now();
+  for (int t = 0; t < ticks; ++t)
+  {
+    SnakeInput input = agent(sim, agentRng);
+
+    auto tickStart = Clock::now();
+    sim.Step(input);
+    latencies[t] = (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - tickStart).count();
+
+    longest = std::max(longest, sim.body.Size());
+    deaths += sim.isGameOver;
+  }
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  long long tickAllocations = allocations - allocationsBefore;
+
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&](double p) { return latencies[std::min<size_t>(ticks - 1, (size_t)(p * ticks))]; };
+
+  std::printf("%dx%d board, %s agent, %d ticks in %.3f s: %.0f ticks/s\n", columns, rows, greedy ? "greedy" : "random",
+              ticks, seconds, ticks / seconds);
+  std::printf("tick latency p50 %u ns, p99 %u ns, max %u ns\n", percentile(0.50), percentile(0.99),
+              latencies[ticks - 1]);
+  std::printf("allocations while stepping %lld, deaths %d, longest snake %d\n", tickAllocations, deaths, longest);
+
+  return 0;
+}
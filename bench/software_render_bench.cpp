@@ -0,0 +1,205 @@
+#include "../include/SoftwareRenderer.hpp"
+#include "../include/TextureAtlas.hpp"
+#include "../src/space_invaders_draw.hpp"
+#include "../src/space_invaders_sim.hpp"
+#include "raylib.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Plays Space Invaders with scripted input and draws every frame with DrawSpaceInvaders(), the draw code of
+// space_invaders.cpp, into a raylib::SoftwareRenderer with no window, once rasterized on the calling thread and once
+// on a raylib::ThreadPool, and reports the frames per second of both. The two frames must be the same byte for byte.
+// Before that, checks that an unscaled texture comes out unchanged and one rotated by 90 degrees comes out as
+// ::ImageRotateCW() makes it. The default font needs a GL context to load, so text uses a blocky stand-in font built
+// here. -march=native blends spans with AVX2 where the CPU has it.
+// Compile command:  g++ software_render_bench.cpp -O2 -march=native -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [frames] [workers, 0 for one per hardware thread] [assets directory]
+
+namespace
+{
+using namespace space_invaders;
+using Clock = std::chrono::steady_clock;
+
+// Texture handles only name pixels handed to the renderers, there is no GPU behind them
+::Texture2D backgroundTexture{1, 0, 0, 0, 0};
+::Texture2D atlasTexture{2, 0, 0, 0, 0};
+
+double elapsedMs(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Cheap scripted agent: holds a random direction for a while and fires most of the time
+SpaceInvadersInput scriptedInput(uint32_t &state)
+{
+  state = state * 1664525u + 1013904223u;
+  uint32_t bits = state >> 16;
+
+  SpaceInvadersInput input;
+  input.left = (bits & 0x3) == 0;
+  input.right = (bits & 0x3) == 1;
+  input.up = (bits & 0xc) == 0;
+  input.down = (bits & 0xc) == 4;
+  input.fire = (bits & 0x70) != 0;
+  input.restart = true;
+  return input;
+}
+
+// Printable ASCII as 6x10 glyphs with a pattern taken from the character code
+void setStandInFont(raylib::SoftwareRenderer &renderer)
+{
+  const int count = 95;
+  std::vector<::CharInfo> chars(count);
+  std::vector<::Rectangle> recs(count, ::Rectangle{0, 0, 6, 10});
+  for (int i = 0; i < count; ++i)
+  {
+    int code = 32 + i;
+    ::Image glyph = ::GenImageColor(6, 10, BLANK);
+    ::Color *pixels = (::Color *)glyph.data;
+    for (int y = 1; y < 9; ++y)
+    {
+      for (int x = 0; x < 5; ++x)
+      {
+        if ((code * (y + 3) >> x) & 1)
+        {
+          pixels[y * 6 + x] = WHITE;
+        }
+      }
+    }
+    chars[i] = ::CharInfo{code, 0, 0, 0, glyph};
+  }
+  renderer.SetFont(::Font{10, count, ::Texture2D{}, recs.data(), chars.data()});
+  for (::CharInfo &info : chars)
+  {
+    ::UnloadImage(info.image);
+  }
+}
+
+// The pixels of image at (x, y) in the frame, compared with image
+bool sameAt(const ::Image &frame, int x, int y, const ::Image &image)
+{
+  for (int row = 0; row < image.height; ++row)
+  {
+    if (std::memcmp((const ::Color *)frame.data + (size_t)(y + row) * frame.width + x,
+                    (const ::Color *)image.data + (size_t)row * image.width, image.width * sizeof(::Color)) != 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// An opaque texture drawn as is must come out unchanged, and rotated by 90 degrees as ::ImageRotateCW() makes it
+bool checkBlits()
+{
+  ::Image texture = ::GenImageColor(37, 23, BLANK);
+  for (int i = 0; i < texture.width * texture.height; ++i)
+  {
+    ((::Color *)texture.data)[i] = ::Color{(unsigned char)(i * 7), (unsigned char)(i * 13), (unsigned char)i, 255};
+  }
+  raylib::SoftwareRenderer renderer{200, 150};
+  ::Texture2D handle{1, texture.width, texture.height, 1, UNCOMPRESSED_R8G8B8A8};
+  renderer.SetTexture(handle, texture);
+  renderer.ClearBackground(BLACK);
+  renderer.DrawTexture(handle, raylib::Vector2{10, 20});
+  renderer.DrawTexture(handle, raylib::Vector2{150, 20}, 90.0f);
+  renderer.Render();
+
+  bool ok = sameAt(renderer.GetImage(), 10, 20, texture);
+  ::ImageRotateCW(&texture);
+  ok = ok && sameAt(renderer.GetImage(), 150 - texture.width, 20, texture);
+  ::UnloadImage(texture);
+  std::printf("Texture blits    %s\n", ok ? "exact" : "differ");
+  if (!ok)
+  {
+    std::printf("MISMATCH in the texture blits\n");
+  }
+  return ok;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  int frames = argc > 1 ? std::atoi(argv[1]) : 2000;
+  int workers = argc > 2 ? std::atoi(argv[2]) : 0;
+  std::string directory = argc > 3 ? argv[3] : "../assets";
+  if (frames < 1 || workers < 0)
+  {
+    std::fprintf(stderr, "usage: %s [frames] [workers] [assets directory]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  ::SetTraceLogLevel(::LOG_WARNING);
+  bool ok = checkBlits();
+
+  raylib::TextureAtlas atlas;
+  ::Image background = ::LoadImage((directory + "/space_bg.png").c_str());
+  if (background.data == nullptr || !atlas.Pack({{"player", directory + "/space_player.png"},
+                                                 {"enemy", directory + "/space_enemy.png"},
+                                                 {"enemy2", directory + "/space_enemy2.png"}}))
+  {
+    std::fprintf(stderr, "could not load the Space Invaders images from %s\n", directory.c_str());
+    return EXIT_FAILURE;
+  }
+  backgroundTexture = ::Texture2D{backgroundTexture.id, background.width, background.height, 1, background.format};
+  atlasTexture = ::Texture2D{atlasTexture.id, atlas.GetImage().width, atlas.GetImage().height, 1,
+                             atlas.GetImage().format};
+
+  raylib::ThreadPool pool{workers};
+  raylib::SoftwareRenderer serial{SCREEN_WIDTH, SCREEN_HEIGHT};
+  raylib::SoftwareRenderer parallel{SCREEN_WIDTH, SCREEN_HEIGHT};
+  for (raylib::SoftwareRenderer *renderer : {&serial, &parallel})
+  {
+    renderer->SetTexture(backgroundTexture, background);
+    renderer->SetTexture(atlasTexture, atlas.GetImage());
+    setStandInFont(*renderer);
+  }
+  ::UnloadImage(background);
+
+  Random rng{1};
+  SpaceInvadersSim sim{rng};
+  uint32_t agent = 0x9e3779b9u;
+  raylib::SpriteBatch sprites;
+  double serialMs = 0, parallelMs = 0;
+  int mismatch = -1;
+  int rendered = 0;
+  for (int frame = 0; frame < frames && mismatch < 0; ++frame)
+  {
+    sim.Step(scriptedInput(agent));
+    float blend = (frame % 4) / 4.0f;
+
+    auto start = Clock::now();
+    DrawSpaceInvaders(serial, sim, blend, backgroundTexture, atlas, atlasTexture, sprites);
+    serial.Render();
+    serialMs += elapsedMs(start);
+
+    start = Clock::now();
+    DrawSpaceInvaders(parallel, sim, blend, backgroundTexture, atlas, atlasTexture, sprites);
+    parallel.Render(pool);
+    parallelMs += elapsedMs(start);
+    ++rendered;
+
+    if (std::memcmp(serial.GetImage().data, parallel.GetImage().data,
+                    (size_t)SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(::Color)) != 0)
+    {
+      mismatch = frame;
+    }
+  }
+
+  std::printf("%dx%d, %d frames, %d workers and the calling thread\n", SCREEN_WIDTH, SCREEN_HEIGHT, rendered,
+              pool.Workers());
+  std::printf("Space Invaders   serial %7.1f fps  tiled %7.1f fps  x%5.2f\n", rendered * 1000.0 / serialMs,
+              rendered * 1000.0 / parallelMs, serialMs / parallelMs);
+  if (mismatch >= 0)
+  {
+    std::printf("MISMATCH in frame %d\n", mismatch);
+    ok = false;
+  }
+  return ok ? 0 : EXIT_FAILURE;
+}
@@ -0,0 +1,91 @@
+#include "../src/input_log.hpp"
+#include "../src/space_invaders_sim.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// Replays an input log recorded with `space_invaders --record <file>` through SpaceInvadersSim, no window required.
+// Every run restarts from the logged seed, so all runs must end in the same state; a mismatch means the rules are no
+// longer deterministic.
+// Compile command:  g++ space_invaders_replay.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out <log file> [runs]
+
+namespace
+{
+using namespace space_invaders;
+
+struct Outcome
+{
+  int score;
+  int wave;
+  bool isGameOver;
+
+  bool operator==(const Outcome &other) const
+  {
+    return score == other.score && wave == other.wave && isGameOver == other.isGameOver;
+  }
+};
+
+// Same order of events as the game: seed, then InitGame()
+Outcome replay(const InputLog &log, Random &rng, SpaceInvadersSim &sim)
+{
+  rng.Seed(log.seed);
+  sim.Reset();
+
+  for (const TickInput &tick : log.ticks)
+  {
+    SpaceInvadersInput input = SpaceInvadersInput::FromTick(tick);
+    if (sim.isGameOver && input.restart)
+    {
+      sim.Reset();
+      continue;
+    }
+    sim.Step(input);
+  }
+
+  return Outcome{sim.score, (int)sim.wave + 1, sim.isGameOver};
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  if (argc < 2)
+  {
+    std::fprintf(stderr, "usage: %s <log file> [runs]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  int runs = argc > 2 ? std::atoi(argv[2]) : 100;
+
+  InputLog log;
+  if (!log.Load(argv[1]))
+  {
+    std::fprintf(stderr, "Could not read input log %s\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  Random rng;
+  SpaceInvadersSim sim{rng};
+  Outcome first = replay(log, rng, sim);
+
+  auto start = std::chrono::steady_clock::now();
+  for (int run = 1; run < runs; ++run)
+  {
+    if (!(replay(log, rng, sim) == first))
+    {
+      std::fprintf(stderr, "run %d diverged from the first replay\n", run);
+      return EXIT_FAILURE;
+    }
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  double totalTicks = (double)log.ticks.size() * (runs - 1);
+  std::printf("%zu ticks (%.1f s of play) x %d runs, score %d, wave %d, game over %d\n", log.ticks.size(),
+              (double)log.ticks.size() / log.ticksPerSecond, runs, first.score, first.wave, first.isGameOver);
+  if (totalTicks > 0)
+  {
+    std::printf("%.0f ticks/s (%.1f ns/tick)\n", totalTicks / seconds, seconds * 1e9 / totalTicks);
+  }
+
+  return 0;
+}
@@ -0,0 +1,75 @@
+#include "../src/space_invaders_sim.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Steps many independent Space Invaders simulations with scripted input, no window required.
+// Compile command:  g++ space_invaders_sim_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [instances] [ticks]
+
+namespace
+{
+using namespace space_invaders;
+
+// Cheap scripted agent: holds a random direction for a while and fires most of the time
+SpaceInvadersInput scriptedInput(uint32_t &state)
+{
+  state = state * 1664525u + 1013904223u;
+  uint32_t bits = state >> 16;
+
+  SpaceInvadersInput input;
+  input.left = (bits & 0x3) == 0;
+  input.right = (bits & 0x3) == 1;
+  input.up = (bits & 0xc) == 0;
+  input.down = (bits & 0xc) == 4;
+  input.fire = (bits & 0x70) != 0;
+  input.restart = true;
+  return input;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  int instances = argc > 1 ? std::atoi(argv[1]) : 64;
+  int ticks = argc > 2 ? std::atoi(argv[2]) : 20000;
+
+  // Every instance gets its own generator and agent, so instances share no state
+  std::vector<Random> randoms;
+  std::vector<SpaceInvadersSim> sims;
+  std::vector<uint32_t> agents(instances);
+  randoms.reserve(instances);
+  sims.reserve(instances);
+  for (int i = 0; i < instances; ++i)
+  {
+    randoms.emplace_back(i + 1);
+    sims.emplace_back(randoms[i]);
+    agents[i] = 0x9e3779b9u * (i + 1);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  long long totalScore = 0;
+  for (int t = 0; t < ticks; ++t)
+  {
+    for (int i = 0; i < instances; ++i)
+    {
+      sims[i].Step(scriptedInput(agents[i]));
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  for (const auto &sim : sims)
+  {
+    totalScore += sim.score;
+  }
+
+  double seconds = std::chrono::duration<double>(end - start).count();
+  double totalTicks = (double)instances * ticks;
+  std::printf("%d instances x %d ticks in %.3f s\n", instances, ticks, seconds);
+  std::printf("%.0f ticks/s (%.1f ns/tick), score checksum %lld\n", totalTicks / seconds, seconds * 1e9 / totalTicks,
+              totalScore);
+
+  return 0;
+}
@@ -0,0 +1,93 @@
+#include "../include/SpriteBatch.hpp"
+#include "../src/random.hpp"
+#include "raylib.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Fills a raylib::SpriteBatch with sprites on a few textures in random order and flushes it once per frame, no
+// window required. The textures are never loaded: the submit function only counts what raylib would be asked to
+// draw, and checks that every sprite arrives exactly once, on its own texture, in the order it was added.
+// "draw calls" is one per texture change, so the unbatched figure is what drawing the sprites as they come costs.
+// Compile command:  g++ sprite_batch_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [sprites per frame] [textures] [frames]
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+} // namespace
+
+int main(int argc, char **argv)
+{
+  int sprites = argc > 1 ? std::atoi(argv[1]) : 10000;
+  int textureCount = argc > 2 ? std::atoi(argv[2]) : 4;
+  int frames = argc > 3 ? std::atoi(argv[3]) : 1000;
+  if (sprites < 1 || textureCount < 1 || frames < 1)
+  {
+    std::fprintf(stderr, "usage: %s [sprites per frame] [textures] [frames]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  std::vector<::Texture2D> textures(textureCount);
+  for (int t = 0; t < textureCount; ++t)
+  {
+    textures[t] = ::Texture2D{(unsigned int)t + 1, 64, 64, 1, ::UNCOMPRESSED_R8G8B8A8};
+  }
+
+  // The same scene every frame: each sprite picks a texture at random and remembers its place in x
+  Random rng{1};
+  std::vector<int> picks(sprites);
+  rng.Fill(picks.data(), picks.size(), 0, textureCount - 1);
+
+  long long unbatchedCalls = 0;
+  for (int i = 0; i < sprites; ++i)
+  {
+    unbatchedCalls += i == 0 || picks[i] != picks[i - 1];
+  }
+
+  raylib::SpriteBatch batch{sprites};
+  std::vector<int> lastSeen(textureCount + 1);
+  long long received = 0;
+  bool ordered = true;
+  auto submit = [&](const ::Texture2D &texture, const raylib::SpriteBatch::Quad *quads, int count) {
+    for (int i = 0; i < count; ++i)
+    {
+      int index = (int)quads[i].dest.x;
+      ordered &= quads[i].texture.id == texture.id && (unsigned int)picks[index] + 1 == texture.id &&
+                 index >= lastSeen[texture.id];
+      lastSeen[texture.id] = index;
+    }
+    received += count;
+  };
+
+  auto start = Clock::now();
+  for (int f = 0; f < frames; ++f)
+  {
+    for (int i = 0; i < sprites; ++i)
+    {
+      batch.Add(textures[picks[i]], ::Rectangle{0, 0, 16, 16}, ::Vector2{(float)i, 0}, ::WHITE);
+    }
+    std::fill(lastSeen.begin(), lastSeen.end(), 0);
+    batch.Flush(submit);
+  }
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  const raylib::SpriteBatch::Stats &stats = batch.GetStats();
+  std::printf("%d sprites on %d textures, %d frames in %.3f s: %.1f ns/sprite\n", sprites, textureCount, frames,
+              seconds, seconds * 1e9 / ((double)sprites * frames));
+  std::printf("flushes %lld, quads per flush %.1f, draw calls per flush %.1f, quads per draw call %.1f\n",
+              stats.flushes, stats.QuadsPerFlush(), (double)stats.submissions / stats.flushes,
+              stats.QuadsPerSubmission());
+  std::printf("unbatched draw calls per frame %lld, quads per draw call %.1f\n", unbatchedCalls,
+              (double)sprites / unbatchedCalls);
+
+  if (received != (long long)sprites * frames || !ordered)
+  {
+    std::printf("MISMATCH: received %lld quads, order kept %d\n", received, ordered);
+    return EXIT_FAILURE;
+  }
+  return 0;
+}
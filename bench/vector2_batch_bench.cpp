@@ -0,0 +1,153 @@
+#include "../include/Vector2Batch.hpp"
+#include "../src/random.hpp"
+#include "bench_util.hpp"
+#include "raylib.h"
+#include "raymath.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Runs each raylib::Vector2Batch kernel and the per-element raymath loop it replaces (Vector2Add() and friends) over
+// the same arrays of random vectors, and checks that both agree to within float rounding. No window required.
+// Build with -march=native to get the AVX2 path where the CPU has it, the default x86-64 target uses SSE2.
+// Compile command:  g++ vector2_batch_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [vectors] [rounds]
+
+namespace
+{
+const bench::Sides SIDES{"raymath", "batch", "vector"};
+} // namespace
+
+int main(int argc, char **argv)
+{
+  long long vectors = argc > 1 ? std::atoll(argv[1]) : 4099;
+  int rounds = argc > 2 ? std::atoi(argv[2]) : 20000;
+  if (vectors < 1 || rounds < 1)
+  {
+    std::fprintf(stderr, "usage: %s [vectors] [rounds]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  size_t count = (size_t)vectors;
+
+  // Coordinates in [-1000, 1000], never both zero so raymath's Vector2Normalize() stays finite
+  Random rng{1};
+  std::vector<::Vector2> a(count), b(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    a[i] = ::Vector2{rng.GetRandomValue(-100000, 100000) / 100.0f, rng.GetRandomValue(-100000, 100000) / 100.0f};
+    b[i] = ::Vector2{rng.GetRandomValue(-100000, 100000) / 100.0f, rng.GetRandomValue(-100000, 100000) / 100.0f};
+    if (a[i].x == 0 && a[i].y == 0)
+    {
+      a[i].x = 1;
+    }
+  }
+  ::Vector2 offset{12.5f, -3.25f};
+  ::Vector2 point{40.0f, -75.0f};
+
+  std::vector<float> expected(2 * count), actual(2 * count);
+  ::Vector2 *expectedVectors = reinterpret_cast<::Vector2 *>(expected.data());
+  ::Vector2 *actualVectors = reinterpret_cast<::Vector2 *>(actual.data());
+
+  std::printf("%lld vectors, %d rounds, %s\n", vectors, rounds,
+#if defined(__AVX2__)
+              "AVX2"
+#elif defined(__SSE2__)
+              "SSE2"
+#elif defined(RAYLIB_CPP_SIMD)
+              "NEON"
+#else
+              "scalar"
+#endif
+  );
+
+  bool ok = true;
+  ok &= bench::compare(
+      "Add", SIDES, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          expectedVectors[i] = ::Vector2Add(a[i], b[i]);
+        }
+      },
+      [&]() { raylib::Vector2Batch::Add(a.data(), b.data(), actualVectors, count); });
+  ok &= bench::compare(
+      "AddOffset", SIDES, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          expectedVectors[i] = ::Vector2Add(a[i], offset);
+        }
+      },
+      [&]() { raylib::Vector2Batch::Add(a.data(), offset, actualVectors, count); });
+  ok &= bench::compare(
+      "Scale", SIDES, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          expectedVectors[i] = ::Vector2Scale(a[i], 0.75f);
+        }
+      },
+      [&]() { raylib::Vector2Batch::Scale(a.data(), 0.75f, actualVectors, count); });
+  ok &= bench::compare(
+      "Lerp", SIDES, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          expectedVectors[i] = ::Vector2Lerp(a[i], b[i], 0.3f);
+        }
+      },
+      [&]() { raylib::Vector2Batch::Lerp(a.data(), b.data(), 0.3f, actualVectors, count); });
+  ok &= bench::compare(
+      "Normalize", SIDES, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          expectedVectors[i] = ::Vector2Normalize(a[i]);
+        }
+      },
+      [&]() { raylib::Vector2Batch::Normalize(a.data(), actualVectors, count); });
+
+  // Length and Distance fill the first half of the arrays, clear the rest so it compares equal
+  std::fill(expected.begin(), expected.end(), 0.0f);
+  std::fill(actual.begin(), actual.end(), 0.0f);
+  ok &= bench::compare(
+      "Length", SIDES, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          expected[i] = ::Vector2Length(a[i]);
+        }
+      },
+      [&]() { raylib::Vector2Batch::Length(a.data(), actual.data(), count); });
+  ok &= bench::compare(
+      "Distance", SIDES, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          expected[i] = ::Vector2Distance(a[i], point);
+        }
+      },
+      [&]() { raylib::Vector2Batch::Distance(a.data(), point, actual.data(), count); });
+
+  // In place, with zero vectors mixed in: they must come out zero instead of NaN
+  std::vector<::Vector2> inPlace(a);
+  for (size_t i = 0; i < count; i += 7)
+  {
+    inPlace[i] = ::Vector2{0, 0};
+  }
+  raylib::Vector2Batch::Normalize(inPlace.data(), inPlace.data(), count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    float length = sqrtf(inPlace[i].x * inPlace[i].x + inPlace[i].y * inPlace[i].y);
+    if (i % 7 == 0 ? length != 0 : fabsf(length - 1) > 1e-5f)
+    {
+      std::printf("MISMATCH: in-place Normalize gives length %f at %zu\n", length, i);
+      return EXIT_FAILURE;
+    }
+  }
+
+  return ok ? 0 : EXIT_FAILURE;
+}
@@ -0,0 +1,152 @@
+#include "../include/Vector3Stream.hpp"
+#include "../src/random.hpp"
+#include "bench_util.hpp"
+#include "raylib.h"
+#include "raymath.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Runs the raylib::Vector3Stream kernels and the raymath loops over ::Vector3 arrays they replace (Vector3DotProduct()
+// and friends, MeshBoundingBox()) on the vertices of a random mesh, and checks that both agree to within float
+// rounding. The kernels work in place, so both sides of each timing start from a fresh copy of the input.
+// Build with -march=native to get the AVX2 path where the CPU has it, the default x86-64 target uses SSE2.
+// Compile command:  g++ vector3_stream_bench.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [vertices] [rounds]
+
+namespace
+{
+const bench::Sides SIDES{"raymath", "stream", "vertex"};
+} // namespace
+
+int main(int argc, char **argv)
+{
+  long long vertices = argc > 1 ? std::atoll(argv[1]) : 1000003;
+  int rounds = argc > 2 ? std::atoi(argv[2]) : 100;
+  if (vertices < 1 || vertices > 0x7fffffff || rounds < 1)
+  {
+    std::fprintf(stderr, "usage: %s [vertices] [rounds]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  size_t count = (size_t)vertices;
+
+  // Coordinates in [-1, 1], every seventh vertex zero for Normalize()
+  Random rng{1};
+  std::vector<::Vector3> points(count), others(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    for (::Vector3 *v : {&points[i], &others[i]})
+    {
+      *v = ::Vector3{rng.GetRandomValue(-10000, 10000) / 10000.0f, rng.GetRandomValue(-10000, 10000) / 10000.0f,
+                     rng.GetRandomValue(-10000, 10000) / 10000.0f};
+    }
+    if (i % 7 == 0)
+    {
+      points[i] = ::Vector3{0, 0, 0};
+    }
+  }
+  ::Mesh mesh{};
+  mesh.vertexCount = (int)count;
+  mesh.vertices = &points[0].x;
+  ::Matrix transform = ::Matrix{0.8f, -0.6f, 0.0f, 12.0f, 0.6f, 0.8f, 0.0f, -7.5f,
+                                0.0f, 0.0f,  1.5f, 3.0f,  0.0f, 0.0f, 0.0f, 1.0f};
+
+  // Bringing the mesh in and writing it back
+  raylib::Vector3Stream source(mesh);
+  double loadNs = bench::nsPerItem(
+      rounds, count, [&]() { source.Load(reinterpret_cast<const ::Vector3 *>(mesh.vertices), count); });
+  std::vector<float> copy(3 * count);
+  ::Mesh out{};
+  out.vertexCount = (int)count;
+  out.vertices = copy.data();
+  double storeNs = bench::nsPerItem(rounds, count, [&]() { source.Store(&out); });
+  if (!std::equal(copy.begin(), copy.end(), mesh.vertices))
+  {
+    std::printf("MISMATCH: the mesh does not come back unchanged\n");
+    return EXIT_FAILURE;
+  }
+  raylib::Vector3Stream other(others.data(), count);
+
+  std::printf("%lld vertices, %d rounds, %s, mesh in %.3f ns/vertex, out %.3f ns/vertex\n", vertices, rounds,
+#if defined(__AVX2__)
+              "AVX2",
+#elif defined(__SSE2__)
+              "SSE2",
+#elif defined(RAYLIB_CPP_SIMD)
+              "NEON",
+#else
+              "scalar",
+#endif
+              loadNs, storeNs);
+
+  std::vector<float> expected(3 * count), actual(3 * count);
+  std::vector<::Vector3> work(count);
+  raylib::Vector3Stream stream;
+  ::Vector3 *expectedVectors = reinterpret_cast<::Vector3 *>(expected.data());
+  ::Vector3 *actualVectors = reinterpret_cast<::Vector3 *>(actual.data());
+
+  bool ok = true;
+  ok &= bench::compare(
+      "Dot", SIDES, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+          expected[i] = ::Vector3DotProduct(points[i], others[i]);
+        }
+      },
+      [&]() { source.DotProduct(other, actual.data()); });
+  ok &= bench::compare(
+      "Cross", SIDES, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        work = points;
+        for (size_t i = 0; i < count; ++i)
+        {
+          work[i] = ::Vector3CrossProduct(work[i], others[i]);
+        }
+        std::copy(work.begin(), work.end(), expectedVectors);
+      },
+      [&]() {
+        stream = source;
+        stream.CrossProduct(other).Store(actualVectors);
+      });
+  ok &= bench::compare(
+      "Normalize", SIDES, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        work = points;
+        for (size_t i = 0; i < count; ++i)
+        {
+          work[i] = ::Vector3Normalize(work[i]);
+        }
+        std::copy(work.begin(), work.end(), expectedVectors);
+      },
+      [&]() {
+        stream = source;
+        stream.Normalize().Store(actualVectors);
+      });
+  ok &= bench::compare(
+      "Transform", SIDES, rounds, count, 1e-5f, expected, actual,
+      [&]() {
+        work = points;
+        for (size_t i = 0; i < count; ++i)
+        {
+          work[i] = ::Vector3Transform(work[i], transform);
+        }
+        std::copy(work.begin(), work.end(), expectedVectors);
+      },
+      [&]() {
+        stream = source;
+        stream.Transform(transform).Store(actualVectors);
+      });
+
+  std::fill(expected.begin(), expected.end(), 0.0f);
+  std::fill(actual.begin(), actual.end(), 0.0f);
+  ::BoundingBox *expectedBox = reinterpret_cast<::BoundingBox *>(expected.data());
+  ::BoundingBox *actualBox = reinterpret_cast<::BoundingBox *>(actual.data());
+  ok &= bench::compare(
+      "Bounds", SIDES, rounds, count, 1e-5f, expected, actual,
+      [&]() { *expectedBox = ::MeshBoundingBox(mesh); }, [&]() { *actualBox = source.GetBoundingBox(); });
+
+  return ok ? 0 : EXIT_FAILURE;
+}
@@ -0,0 +1,147 @@
+#ifndef RAYLIB_CPP_ASSETCACHE_HPP_
+#define RAYLIB_CPP_ASSETCACHE_HPP_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+#include "raylib.h"
+#ifdef __cplusplus
+}
+#endif
+
+#include "./Font.hpp"
+#include "./Image.hpp"
+#include "./ImageLoader.hpp"
+#include "./Sound.hpp"
+#include "./Texture2D.hpp"
+#include "./Wave.hpp"
+
+namespace raylib
+{
+/**
+ * Loads every asset at most once while anyone holds on to it.
+ *
+ * Assets are keyed by file name and handed out as reference-counted handles. Loading a file that is already loaded
+ * returns the same asset without touching the disk, and an asset is unloaded by its own destructor when the last
+ * handle to it goes away. A game that keeps its handles across a restart therefore reloads nothing.
+ *
+ * Not thread-safe: load and release assets on the thread that owns the window.
+ */
+class AssetCache
+{
+public:
+  template <typename T> using Handle = std::shared_ptr<T>;
+
+  /**
+   * Counters since construction, a miss being an actual load.
+   */
+  struct Stats
+  {
+    long long hits = 0;
+    long long misses = 0;
+  };
+
+  inline Handle<Texture2D> LoadTexture(const std::string &fileName)
+  {
+    return Fetch(textures, fileName, [&fileName]() { return std::make_shared<Texture2D>(fileName); });
+  }
+
+  /**
+   * Like LoadTexture(), but on a miss the file is decoded in the background and the texture stays empty until the
+   * uploader's Update() uploads it.
+   */
+  inline Handle<Texture2D> LoadTextureAsync(const std::string &fileName, TextureUploader &uploader)
+  {
+    return Fetch(textures, fileName, [&fileName, &uploader]() { return uploader.Load(fileName); });
+  }
+
+  /**
+   * Get the texture cached under key, or upload the ::Texture2D that make() returns and cache it. For textures that
+   * are built rather than read from one file, e.g. a sprite atlas.
+   */
+  template <typename Make> Handle<Texture2D> LoadTexture(const std::string &key, Make make)
+  {
+    return Fetch(textures, key, [&make]() {
+      auto texture = std::make_shared<Texture2D>();
+      texture->set(make());
+      return texture;
+    });
+  }
+
+  inline Handle<Image> LoadImage(const std::string &fileName)
+  {
+    return Fetch(images, fileName, [&fileName]() { return std::make_shared<Image>(fileName); });
+  }
+
+  inline Handle<Font> LoadFont(const std::string &fileName)
+  {
+    return Fetch(fonts, fileName, [&fileName]() { return std::make_shared<Font>(fileName); });
+  }
+
+  inline Handle<Sound> LoadSound(const std::string &fileName)
+  {
+    return Fetch(sounds, fileName, [&fileName]() { return std::make_shared<Sound>(fileName); });
+  }
+
+  inline Handle<Wave> LoadWave(const std::string &fileName)
+  {
+    return Fetch(waves, fileName, [&fileName]() { return std::make_shared<Wave>(fileName); });
+  }
+
+  /**
+   * Number of assets currently loaded through the cache.
+   */
+  int Count() const
+  {
+    return Live(textures) + Live(images) + Live(fonts) + Live(sounds) + Live(waves);
+  }
+
+  inline const Stats &GetStats() const
+  {
+    return stats;
+  }
+
+private:
+  template <typename T> using Shelf = std::unordered_map<std::string, std::weak_ptr<T>>;
+
+  Shelf<Texture2D> textures;
+  Shelf<Image> images;
+  Shelf<Font> fonts;
+  Shelf<Sound> sounds;
+  Shelf<Wave> waves;
+  Stats stats;
+
+  // Entries of released assets stay behind until their key is loaded again, there is one per file at most
+  template <typename T, typename Load> Handle<T> Fetch(Shelf<T> &shelf, const std::string &key, Load load)
+  {
+    std::weak_ptr<T> &entry = shelf[key];
+    if (Handle<T> asset = entry.lock())
+    {
+      stats.hits++;
+      return asset;
+    }
+
+    stats.misses++;
+    Handle<T> asset = load();
+    entry = asset;
+    return asset;
+  }
+
+  template <typename T> static int Live(const Shelf<T> &shelf)
+  {
+    int live = 0;
+    for (const auto &entry : shelf)
+    {
+      live += !entry.second.expired();
+    }
+    return live;
+  }
+};
+} // namespace raylib
+
+#endif
@@ -17,31 +17,22 @@ extern "C"
 
 namespace raylib
 {
+/**
+ * Color type. Trivially copyable, and constexpr when built from its components, so colors can be game constants.
+ */
 class Color : public ::Color
 {
 public:
-  Color()
+  constexpr Color() : ::Color{0, 0, 0, 255} {}
+  constexpr Color(const ::Color &color) : ::Color{color.r, color.g, color.b, color.a} {}
+  constexpr Color(unsigned char red, unsigned char green, unsigned char blue, unsigned char alpha = 255)
+      : ::Color{red, green, blue, alpha}
   {
-    r = 0;
-    g = 0;
-    b = 0;
-    a = 255;
   }
-  Color(::Color color)
-  {
-    r = color.r;
-    g = color.g;
-    b = color.b;
-    a = color.a;
-  }
-  Color(unsigned char red, unsigned char green, unsigned char blue, unsigned char alpha = 255)
-  {
-    r = red;
-    g = green;
-    b = blue;
-    a = alpha;
-  };
-  Color(::Vector3 hsv)
+  /**
+   * The color with the given hue, saturation and value, see ::ColorFromHSV().
+   */
+  explicit Color(::Vector3 hsv)
   {
     set(::ColorFromHSV(hsv.x, hsv.y, hsv.z));
   };
@@ -49,20 +40,15 @@ public:
   {
     set(::GetColor(hexValue));
   };
-  Color(Vector4 normalized)
+  /**
+   * The color with the given components in [0, 1], see ::ColorFromNormalized().
+   */
+  explicit Color(Vector4 normalized)
   {
     set(::ColorFromNormalized(normalized));
   }
 
-  inline void set(const ::Color &color)
-  {
-    r = color.r;
-    g = color.g;
-    b = color.b;
-    a = color.a;
-  }
-
-  inline void set(const Color &color)
+  constexpr void set(const ::Color &color)
   {
     r = color.r;
     g = color.g;
@@ -97,7 +83,7 @@ public:
   static Color Magenta;
   static Color RayWhite;
 
-  int ToInt()
+  int ToInt() const
   {
     return ::ColorToInt(*this);
   }
@@ -114,12 +100,12 @@ public:
     return a;
   }
 
-  Vector4 Normalize()
+  Vector4 Normalize() const
   {
     return ::ColorNormalize(*this);
   }
 
-  Vector3 ToHSV()
+  Vector3 ToHSV() const
   {
     return ::ColorToHSV(*this);
   }
@@ -129,16 +115,20 @@ public:
   GETTERSETTER(unsigned char, B, b)
   GETTERSETTER(unsigned char, A, a)
 
-  Color &operator=(const ::Color &color)
+  constexpr Color &operator=(const ::Color &color)
   {
     set(color);
     return *this;
   }
 
-  Color &operator=(const Color &color)
+  constexpr bool operator==(const ::Color &other) const
   {
-    set(color);
-    return *this;
+    return r == other.r && g == other.g && b == other.b && a == other.a;
+  }
+
+  constexpr bool operator!=(const ::Color &other) const
+  {
+    return !(*this == other);
   }
 
   inline Color &ClearBackground()
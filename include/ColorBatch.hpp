@@ -0,0 +1,287 @@
+#ifndef RAYLIB_CPP_COLORBATCH_HPP_
+#define RAYLIB_CPP_COLORBATCH_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+#include "raylib.h"
+#ifdef __cplusplus
+}
+#endif
+
+#include "./raylib-cpp-simd.hpp"
+
+namespace raylib
+{
+/**
+ * Pixel operations over whole arrays of ::Color (or raylib::Color, which has the same layout), such as the pixels of
+ * an UNCOMPRESSED_R8G8B8A8 image.
+ *
+ * The scalar loop of each kernel is its reference, in integer arithmetic. The SIMD loop unpacks WIDTH pixels into one
+ * float register per channel (see raylib-cpp-simd.hpp), where every intermediate value is an integer small enough to
+ * be exact, so it gives the same bytes as the scalar loop, fused multiply-adds or not. Scaling by 1/255 is the one
+ * inexact step, and its result never comes within 1/512 of a half, so rounding it gives Div255() exactly.
+ * out may be the same array as an input, the arrays may not overlap otherwise.
+ */
+namespace ColorBatch
+{
+/**
+ * round(x / 255) for x in [0, 255 * 255], how the kernels scale a channel by another.
+ */
+constexpr unsigned int Div255(unsigned int x)
+{
+  return (x + 128 + ((x + 128) >> 8)) >> 8;
+}
+
+/**
+ * out[i] = a[i] * tint, per channel and rounded, so WHITE keeps the colors. ::ImageColorTint() truncates instead.
+ */
+inline void Tint(const ::Color *a, ::Color tint, ::Color *out, size_t count)
+{
+  size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+  simd::Lane tr = simd::Set(tint.r / 255.0f);
+  simd::Lane tg = simd::Set(tint.g / 255.0f);
+  simd::Lane tb = simd::Set(tint.b / 255.0f);
+  simd::Lane ta = simd::Set(tint.a / 255.0f);
+  for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+  {
+    simd::Lane r, g, b, alpha;
+    simd::LoadColors(&a[i].r, &r, &g, &b, &alpha);
+    simd::StoreColors(&out[i].r, simd::Mul(r, tr), simd::Mul(g, tg), simd::Mul(b, tb), simd::Mul(alpha, ta));
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    out[i] = ::Color{(unsigned char)Div255(a[i].r * tint.r), (unsigned char)Div255(a[i].g * tint.g),
+                     (unsigned char)Div255(a[i].b * tint.b), (unsigned char)Div255(a[i].a * tint.a)};
+  }
+}
+
+/**
+ * out[i] = a[i] with its alpha scaled by alpha, clamped to [0, 1]. For opaque colors that is ::Fade().
+ */
+inline void Fade(const ::Color *a, float alpha, ::Color *out, size_t count)
+{
+  unsigned int factor = (unsigned int)(255.0f * (alpha < 0.0f ? 0.0f : alpha > 1.0f ? 1.0f : alpha));
+  size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+  simd::Lane scale = simd::Set(factor / 255.0f);
+  for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+  {
+    simd::Lane r, g, b, opacity;
+    simd::LoadColors(&a[i].r, &r, &g, &b, &opacity);
+    simd::StoreColors(&out[i].r, r, g, b, simd::Mul(opacity, scale));
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    out[i] = ::Color{a[i].r, a[i].g, a[i].b, (unsigned char)Div255(a[i].a * factor)};
+  }
+}
+
+/**
+ * out[i] = a[i] with red, green and blue multiplied by its alpha, rounded. ::ImageAlphaPremultiply() truncates.
+ */
+inline void AlphaPremultiply(const ::Color *a, ::Color *out, size_t count)
+{
+  size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+  simd::Lane inv255 = simd::Set(1.0f / 255);
+  for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+  {
+    simd::Lane r, g, b, alpha;
+    simd::LoadColors(&a[i].r, &r, &g, &b, &alpha);
+    simd::Lane scale = simd::Mul(alpha, inv255);
+    simd::StoreColors(&out[i].r, simd::Mul(r, scale), simd::Mul(g, scale), simd::Mul(b, scale), alpha);
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    unsigned int alpha = a[i].a;
+    out[i] = ::Color{(unsigned char)Div255(a[i].r * alpha), (unsigned char)Div255(a[i].g * alpha),
+                     (unsigned char)Div255(a[i].b * alpha), a[i].a};
+  }
+}
+
+/**
+ * out[i] = the luma of a[i] (BT.601 weights in 8-bit fixed point) in red, green and blue, alpha kept. The same gray
+ * as ::ImageColorGrayscale() up to rounding, but the pixels stay RGBA.
+ */
+inline void Grayscale(const ::Color *a, ::Color *out, size_t count)
+{
+  size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+  simd::Lane wr = simd::Set(77);
+  simd::Lane wg = simd::Set(150);
+  simd::Lane wb = simd::Set(29);
+  simd::Lane half = simd::Set(128);
+  simd::Lane inv256 = simd::Set(1.0f / 256);
+  for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+  {
+    simd::Lane r, g, b, alpha;
+    simd::LoadColors(&a[i].r, &r, &g, &b, &alpha);
+    simd::Lane sum = simd::Add(simd::Add(simd::Mul(r, wr), simd::Mul(g, wg)), simd::Add(simd::Mul(b, wb), half));
+    simd::Lane luma = simd::Floor(simd::Mul(sum, inv256));
+    simd::StoreColors(&out[i].r, luma, luma, luma, alpha);
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    unsigned char luma = (unsigned char)((77 * a[i].r + 150 * a[i].g + 29 * a[i].b + 128) >> 8);
+    out[i] = ::Color{luma, luma, luma, a[i].a};
+  }
+}
+
+/**
+ * out[i] = the hue (degrees in [0, 360), 0 for grays), saturation and value of a[i], as ::ColorToHSV() up to float
+ * rounding.
+ */
+inline void ToHSV(const ::Color *a, ::Vector3 *out, size_t count)
+{
+  size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+  simd::Lane one = simd::Set(1);
+  for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+  {
+    simd::Lane r, g, b, alpha;
+    simd::LoadColors(&a[i].r, &r, &g, &b, &alpha);
+    simd::Lane max = simd::Max(simd::Max(r, g), b);
+    simd::Lane delta = simd::Sub(max, simd::Min(simd::Min(r, g), b));
+
+    // hue * delta for each channel being the largest, all exact integers
+    simd::Lane red = simd::Mul(simd::Sub(g, b), simd::Set(60));
+    red = simd::Select(simd::Less(g, b), simd::Add(red, simd::Mul(delta, simd::Set(360))), red);
+    simd::Lane green = simd::Add(simd::Mul(simd::Sub(b, r), simd::Set(60)), simd::Mul(delta, simd::Set(120)));
+    simd::Lane blue = simd::Add(simd::Mul(simd::Sub(r, g), simd::Set(60)), simd::Mul(delta, simd::Set(240)));
+    simd::Lane hue = simd::Select(simd::Equal(r, max), red, simd::Select(simd::Equal(g, max), green, blue));
+
+    simd::Store3(&out[i].x, simd::WherePositive(delta, simd::Div(hue, simd::Max(delta, one))),
+                 simd::WherePositive(max, simd::Div(delta, simd::Max(max, one))), simd::Div(max, simd::Set(255)));
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    int r = a[i].r;
+    int g = a[i].g;
+    int b = a[i].b;
+    int max = std::max(std::max(r, g), b);
+    int delta = max - std::min(std::min(r, g), b);
+    int hue = 0;
+    if (delta > 0)
+    {
+      if (r == max)
+      {
+        hue = 60 * (g - b) + (g < b ? 360 * delta : 0);
+      }
+      else if (g == max)
+      {
+        hue = 60 * (b - r) + 120 * delta;
+      }
+      else
+      {
+        hue = 60 * (r - g) + 240 * delta;
+      }
+    }
+    out[i] = ::Vector3{delta > 0 ? (float)hue / (float)delta : 0.0f, max > 0 ? (float)delta / (float)max : 0.0f,
+                       (float)max / 255.0f};
+  }
+}
+
+/**
+ * out[i] = the opaque color with hue (degrees, wrapped into [0, 360)), saturation and value (both clamped to [0, 1])
+ * hsv[i], within 1 per channel of ::ColorFromHSV(), which truncates. Hue is resolved to 1/256 of a 60 degree sector.
+ */
+inline void FromHSV(const ::Vector3 *hsv, ::Color *out, size_t count)
+{
+  size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+  simd::Lane zero = simd::Set(0);
+  simd::Lane one = simd::Set(1);
+  simd::Lane full = simd::Set(255);
+  simd::Lane turn = simd::Set(360);
+  simd::Lane sectors = simd::Set(1536);
+  for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+  {
+    simd::Lane degrees, saturation, value;
+    simd::Load3(&hsv[i].x, &degrees, &saturation, &value);
+    degrees = simd::Sub(degrees, simd::Mul(simd::Floor(simd::Div(degrees, turn)), turn));
+    simd::Lane hue = simd::Round(simd::Mul(simd::Min(simd::Max(degrees, zero), turn), simd::Set(1536.0f / 360.0f)));
+    value = simd::Round(simd::Mul(simd::Min(simd::Max(value, zero), one), full));
+    saturation = simd::Round(simd::Mul(simd::Min(simd::Max(saturation, zero), one), full));
+    simd::Lane chroma = simd::Round(simd::Mul(simd::Mul(value, saturation), simd::Set(1.0f / 255)));
+
+    simd::Lane channels[3];
+    for (int c = 0; c < 3; ++c)
+    {
+      // How far the hue is from the channel's sector, 256 per sector, capped at one sector
+      simd::Lane k = simd::Add(hue, simd::Set((5 - 2 * c) * 256.0f));
+      k = simd::Select(simd::Less(k, sectors), k, simd::Sub(k, sectors));
+      k = simd::Min(simd::Max(simd::Min(k, simd::Sub(simd::Set(1024), k)), zero), simd::Set(256));
+      simd::Lane fade = simd::Floor(simd::Mul(simd::Add(simd::Mul(chroma, k), simd::Set(128)), simd::Set(1.0f / 256)));
+      channels[c] = simd::Sub(value, fade);
+    }
+    simd::StoreColors(&out[i].r, channels[0], channels[1], channels[2], full);
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    float degrees = hsv[i].x - floorf(hsv[i].x / 360.0f) * 360.0f;
+    int hue = (int)std::nearbyint(std::min(std::max(degrees, 0.0f), 360.0f) * (1536.0f / 360.0f));
+    unsigned int value = (unsigned int)std::nearbyint(std::min(std::max(hsv[i].z, 0.0f), 1.0f) * 255.0f);
+    unsigned int saturation = (unsigned int)std::nearbyint(std::min(std::max(hsv[i].y, 0.0f), 1.0f) * 255.0f);
+    unsigned int chroma = Div255(value * saturation);
+
+    unsigned char channels[3];
+    for (int c = 0; c < 3; ++c)
+    {
+      int k = hue + (5 - 2 * c) * 256;
+      k = k < 1536 ? k : k - 1536;
+      k = std::min(std::max(std::min(k, 1024 - k), 0), 256);
+      channels[c] = (unsigned char)(value - ((chroma * k + 128) >> 8));
+    }
+    out[i] = ::Color{channels[0], channels[1], channels[2], 255};
+  }
+}
+
+/**
+ * out[i] = src[i] drawn over dst[i]. The colors mix by the source alpha as raylib's default BLEND_ALPHA does, and the
+ * alphas combine as Porter-Duff over, src.a + dst.a * (255 - src.a) / 255, so layers build up to opaque.
+ */
+inline void AlphaBlend(const ::Color *dst, const ::Color *src, ::Color *out, size_t count)
+{
+  size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+  simd::Lane full = simd::Set(255);
+  simd::Lane inv255 = simd::Set(1.0f / 255);
+  for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+  {
+    simd::Lane sr, sg, sb, sa, dr, dg, db, da;
+    simd::LoadColors(&src[i].r, &sr, &sg, &sb, &sa);
+    simd::LoadColors(&dst[i].r, &dr, &dg, &db, &da);
+    simd::Lane rest = simd::Sub(full, sa);
+    simd::StoreColors(&out[i].r, simd::Mul(simd::Add(simd::Mul(sr, sa), simd::Mul(dr, rest)), inv255),
+                      simd::Mul(simd::Add(simd::Mul(sg, sa), simd::Mul(dg, rest)), inv255),
+                      simd::Mul(simd::Add(simd::Mul(sb, sa), simd::Mul(db, rest)), inv255),
+                      simd::Add(sa, simd::Mul(simd::Mul(da, rest), inv255)));
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    unsigned int alpha = src[i].a;
+    unsigned int rest = 255 - alpha;
+    out[i] = ::Color{(unsigned char)Div255(src[i].r * alpha + dst[i].r * rest),
+                     (unsigned char)Div255(src[i].g * alpha + dst[i].g * rest),
+                     (unsigned char)Div255(src[i].b * alpha + dst[i].b * rest),
+                     (unsigned char)(alpha + Div255(dst[i].a * rest))};
+  }
+}
+} // namespace ColorBatch
+} // namespace raylib
+
+#endif
@@ -69,7 +69,7 @@ public:
 
   GETTERSETTER(int, BaseSize, baseSize)
   GETTERSETTER(int, CharsCount, charsCount)
-  GETTERSETTER(Texture2D, Texture, texture)
+  GETTERSETTER(::Texture2D, Texture, texture)
   GETTERSETTER(Rectangle *, Recs, recs)
   GETTERSETTER(CharInfo *, Chars, chars)
 
@@ -1,7 +1,12 @@
 #ifndef RAYLIB_CPP_IMAGE_HPP_
 #define RAYLIB_CPP_IMAGE_HPP_
 
+#include <algorithm>
+#include <cstring>
+#include <numeric>
 #include <string>
+#include <vector>
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -11,6 +16,8 @@ extern "C"
 }
 #endif
 
+#include "./MappedImage.hpp"
+#include "./ThreadPool.hpp"
 #include "./raylib-cpp-utils.hpp"
 
 namespace raylib
@@ -18,6 +25,12 @@ namespace raylib
 class Image : public ::Image
 {
 public:
+  /**
+   * Below this many pixels the overloads taking a ThreadPool run the plain serial version, splitting the image would
+   * cost more than it saves.
+   */
+  static const int PARALLEL_MIN_PIXELS = 256 * 256;
+
   Image(){};
   Image(::Image image)
   {
@@ -125,9 +138,12 @@ public:
     format = image.format;
   }
 
+  /**
+   * Load an image file, .rawimg files copied out of their mapping rather than decoded (see MappedImage).
+   */
   void Load(const std::string &fileName)
   {
-    set(::LoadImage(fileName.c_str()));
+    set(MappedImage::LoadImage(fileName));
   }
 
   void LoadRaw(const std::string &fileName, int width, int height, int format, int headerSize)
@@ -200,6 +216,10 @@ public:
     ::ImageAlphaPremultiply(this);
     return *this;
   }
+  inline Image &AlphaPremultiply(ThreadPool &pool)
+  {
+    return ForEachBand(pool, [](::Image *band) { ::ImageAlphaPremultiply(band); });
+  }
 
   inline Image &Crop(::Rectangle crop)
   {
@@ -211,6 +231,56 @@ public:
     ::ImageResize(this, newWidth, newHeight);
     return *this;
   }
+  /**
+   * Resize (bicubic) in row bands on a pool. Each band resizes a few extra source rows on either side, and bands start
+   * on rows where source and destination line up, so it only splits when the heights share a large enough common
+   * divisor, and runs the serial Resize() otherwise. Pixels can differ from Resize() by 1 per channel, as the filter
+   * weights are computed from band-local coordinates.
+   */
+  Image &Resize(int newWidth, int newHeight, ThreadPool &pool)
+  {
+    if (newWidth <= 0 || newHeight <= 0 || height <= 0)
+    {
+      return Resize(newWidth, newHeight);
+    }
+
+    // The heights split into units of sourceRows source rows that resize to targetRows destination rows each
+    int units = std::gcd(height, newHeight);
+    int sourceRows = height / units;
+    int targetRows = newHeight / units;
+    // The bicubic filter reaches 2 source rows out when enlarging, twice the scale out when shrinking, plus rounding
+    int reach = 2 * std::max(1, (height + newHeight - 1) / newHeight) + 2;
+    int halo = (reach + sourceRows - 1) / sourceRows;
+    // Bands of at least four halos, so the rows resized twice stay under half of the work
+    int bands = BandCount(pool, std::max(width * height, newWidth * newHeight), units / (4 * halo));
+    if (bands < 2)
+    {
+      return Resize(newWidth, newHeight);
+    }
+
+    size_t sourceRowSize = (size_t)::GetPixelDataSize(width, 1, format);
+    size_t targetRowSize = (size_t)::GetPixelDataSize(newWidth, 1, format);
+    unsigned char *resized = (unsigned char *)RL_MALLOC(targetRowSize * newHeight);
+    pool.ParallelFor(bands, [&](int band) {
+      int first = (int)((long long)units * band / bands);
+      int last = (int)((long long)units * (band + 1) / bands);
+      int from = std::max(0, first - halo);
+      int to = std::min(units, last + halo);
+
+      ::Image part = {RL_MALLOC(sourceRowSize * sourceRows * (to - from)), width, sourceRows * (to - from), 1, format};
+      std::memcpy(part.data, (unsigned char *)data + sourceRowSize * sourceRows * from, sourceRowSize * part.height);
+      ::ImageResize(&part, newWidth, targetRows * (to - from));
+      // Keep the rows of the band's own units and drop the halo
+      std::memcpy(resized + targetRowSize * targetRows * first,
+                  (unsigned char *)part.data + targetRowSize * targetRows * (first - from),
+                  targetRowSize * targetRows * (last - first));
+      ::UnloadImage(part);
+    });
+
+    ::UnloadImage(*this);
+    set(::Image{resized, newWidth, newHeight, 1, format});
+    return *this;
+  }
   inline Image &ResizeNN(int newWidth, int newHeight)
   {
     ::ImageResizeNN(this, newWidth, newHeight);
@@ -231,6 +301,14 @@ public:
     ::ImageDither(this, rBpp, gBpp, bBpp, aBpp);
     return *this;
   }
+  /**
+   * Dither in row bands on a pool. The error diffusion starts over at the top of every band, so pixels from there down
+   * can land a level off from what Dither() gives, which leaves no visible seam.
+   */
+  inline Image &Dither(int rBpp, int gBpp, int bBpp, int aBpp, ThreadPool &pool)
+  {
+    return ForEachBand(pool, [=](::Image *band) { ::ImageDither(band, rBpp, gBpp, bBpp, aBpp); });
+  }
 
   inline Image &FlipVertical()
   {
@@ -258,31 +336,55 @@ public:
     ::ImageColorTint(this, color);
     return *this;
   }
+  inline Image &ColorTint(::Color color, ThreadPool &pool)
+  {
+    return ForEachBand(pool, [color](::Image *band) { ::ImageColorTint(band, color); });
+  }
   inline Image &ColorInvert()
   {
     ::ImageColorInvert(this);
     return *this;
   }
+  inline Image &ColorInvert(ThreadPool &pool)
+  {
+    return ForEachBand(pool, [](::Image *band) { ::ImageColorInvert(band); });
+  }
   inline Image &ColorGrayscale()
   {
     ::ImageColorGrayscale(this);
     return *this;
   }
+  inline Image &ColorGrayscale(ThreadPool &pool)
+  {
+    return ForEachBand(pool, [](::Image *band) { ::ImageColorGrayscale(band); });
+  }
   inline Image &ColorContrast(float contrast)
   {
     ::ImageColorContrast(this, contrast);
     return *this;
   }
+  inline Image &ColorContrast(float contrast, ThreadPool &pool)
+  {
+    return ForEachBand(pool, [contrast](::Image *band) { ::ImageColorContrast(band, contrast); });
+  }
   inline Image &ColorBrightness(int brightness)
   {
     ::ImageColorBrightness(this, brightness);
     return *this;
   }
+  inline Image &ColorBrightness(int brightness, ThreadPool &pool)
+  {
+    return ForEachBand(pool, [brightness](::Image *band) { ::ImageColorBrightness(band, brightness); });
+  }
   inline Image &ColorReplace(::Color color, ::Color replace)
   {
     ::ImageColorReplace(this, color, replace);
     return *this;
   }
+  inline Image &ColorReplace(::Color color, ::Color replace, ThreadPool &pool)
+  {
+    return ForEachBand(pool, [color, replace](::Image *band) { ::ImageColorReplace(band, color, replace); });
+  }
 
   inline ::Color *GetPalette(int maxPaletteSize, int *extractCount)
   {
@@ -391,6 +493,68 @@ public:
   {
     return ::LoadTextureFromImage(*this);
   }
+
+private:
+  // How many row bands to split into on pool, at most maxBands; 1 for small, compressed or mipmapped images, which
+  // the serial path handles
+  int BandCount(const ThreadPool &pool, int pixels, int maxBands) const
+  {
+    if (data == nullptr || pixels < PARALLEL_MIN_PIXELS || mipmaps != 1 || format >= COMPRESSED_DXT1_RGB)
+    {
+      return 1;
+    }
+    return std::max(1, std::min(pool.Workers() + 1, maxBands));
+  }
+
+  // Run a pixel-local raylib function on a copy of each row band, then put the bands back together. raylib replaces
+  // the pixel buffer it is given, and may change its format, so the bands cannot be views into this image.
+  template <typename Op> Image &ForEachBand(ThreadPool &pool, const Op &op)
+  {
+    // At least 16 rows per band
+    int bands = BandCount(pool, width * height, height / 16);
+    if (bands < 2)
+    {
+      op(this);
+      return *this;
+    }
+
+    size_t rowSize = (size_t)::GetPixelDataSize(width, 1, format);
+    std::vector<::Image> parts(bands);
+    pool.ParallelFor(bands, [&](int band) {
+      int first = (int)((long long)height * band / bands);
+      int rows = (int)((long long)height * (band + 1) / bands) - first;
+
+      ::Image part = {RL_MALLOC(rowSize * rows), width, rows, 1, format};
+      std::memcpy(part.data, (unsigned char *)data + rowSize * first, rowSize * rows);
+      op(&part);
+      if (part.format == format)
+      {
+        // Same layout, straight back in place
+        std::memcpy((unsigned char *)data + rowSize * first, part.data, rowSize * rows);
+        ::UnloadImage(part);
+        part.data = nullptr;
+      }
+      parts[band] = part;
+    });
+
+    // The format changed (ColorGrayscale(), Dither()), stack the bands into a new buffer
+    if (parts[0].data != nullptr)
+    {
+      int joinedFormat = parts[0].format;
+      size_t joinedRowSize = (size_t)::GetPixelDataSize(width, 1, joinedFormat);
+      unsigned char *joined = (unsigned char *)RL_MALLOC(joinedRowSize * height);
+      unsigned char *row = joined;
+      for (::Image &part : parts)
+      {
+        std::memcpy(row, part.data, joinedRowSize * part.height);
+        row += joinedRowSize * part.height;
+        ::UnloadImage(part);
+      }
+      ::UnloadImage(*this);
+      set(::Image{joined, width, height, 1, joinedFormat});
+    }
+    return *this;
+  }
 };
 } // namespace raylib
 
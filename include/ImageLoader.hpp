@@ -0,0 +1,165 @@
+#ifndef RAYLIB_CPP_IMAGELOADER_HPP_
+#define RAYLIB_CPP_IMAGELOADER_HPP_
+
+#include <chrono>
+#include <deque>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+#include "raylib.h"
+#ifdef __cplusplus
+}
+#endif
+
+#include "./Image.hpp"
+#include "./MappedImage.hpp"
+#include "./Texture2D.hpp"
+#include "./ThreadPool.hpp"
+
+namespace raylib
+{
+/**
+ * Decodes image files on a pool of worker threads.
+ *
+ * Decoding only touches the file and the image's own pixel buffer, so it needs no window and can run anywhere, while
+ * uploading to a texture has to stay on the thread that owns the window, see TextureUploader.
+ */
+class ImageLoader
+{
+public:
+  /**
+   * Start the workers, one per hardware thread by default.
+   */
+  ImageLoader(int workers = 0) : pool{workers} {}
+
+  ImageLoader(const ImageLoader &) = delete;
+  ImageLoader &operator=(const ImageLoader &) = delete;
+
+  inline int Workers() const
+  {
+    return pool.Workers();
+  }
+
+  /**
+   * The workers the images decode on, to run the Image overloads taking a ThreadPool on once loading is done.
+   */
+  inline ThreadPool &Pool()
+  {
+    return pool;
+  }
+
+  /**
+   * Queue a file for decoding, or a .rawimg file for copying out of its mapping. The caller owns the image the
+   * future yields and has to ::UnloadImage() it. Destroying the loader finishes the queued images first.
+   */
+  std::future<::Image> Load(const std::string &fileName)
+  {
+    return pool.Submit([fileName]() { return MappedImage::LoadImage(fileName); });
+  }
+
+private:
+  ThreadPool pool;
+};
+
+/**
+ * Turns images decoded by an ImageLoader into textures, a bounded amount per frame.
+ *
+ * Load() hands out the texture right away, empty until its image is uploaded; raylib draws nothing for an empty
+ * texture. Call Update() once per frame on the thread that owns the window.
+ */
+class TextureUploader
+{
+public:
+  // A 1920x1080 RGBA image is about 8 MB, over budget, so by default such an image goes up on a frame of its own
+  static const long long DEFAULT_BYTES_PER_FRAME = 4 << 20;
+
+  TextureUploader(ImageLoader &loader) : loader{loader} {}
+
+  ~TextureUploader()
+  {
+    for (Queued &queued : queue)
+    {
+      ::UnloadImage(queued.image.get());
+    }
+  }
+
+  TextureUploader(const TextureUploader &) = delete;
+  TextureUploader &operator=(const TextureUploader &) = delete;
+
+  /**
+   * Start decoding a file and return the texture it will be uploaded to.
+   */
+  std::shared_ptr<Texture2D> Load(const std::string &fileName)
+  {
+    auto texture = std::make_shared<Texture2D>();
+    texture->set(::Texture2D{0, 0, 0, 0, 0});
+    queue.push_back(Queued{loader.Load(fileName), texture});
+    return texture;
+  }
+
+  /**
+   * Upload decoded images in request order until byteBudget bytes of pixels went up, at least one image if any is
+   * ready. Returns the number of images uploaded.
+   */
+  int Update(long long byteBudget = DEFAULT_BYTES_PER_FRAME)
+  {
+    int uploaded = 0;
+    long long spent = 0;
+    for (auto pending = queue.begin(); pending != queue.end() && (uploaded == 0 || spent < byteBudget);)
+    {
+      if (pending->image.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+      {
+        ++pending;
+        continue;
+      }
+
+      ::Image image = pending->image.get();
+      if (std::shared_ptr<Texture2D> texture = pending->texture.lock())
+      {
+        texture->set(::LoadTextureFromImage(image));
+        spent += ::GetPixelDataSize(image.width, image.height, image.format);
+        ++uploaded;
+      }
+      ::UnloadImage(image);
+      pending = queue.erase(pending);
+    }
+    return uploaded;
+  }
+
+  /**
+   * Wait for and upload everything still queued.
+   */
+  void Finish()
+  {
+    while (!queue.empty())
+    {
+      queue.front().image.wait();
+      Update(0);
+    }
+  }
+
+  inline int Pending() const
+  {
+    return (int)queue.size();
+  }
+
+private:
+  // An image on its way to a texture, which is dropped if nobody holds the texture anymore once the image is decoded
+  struct Queued
+  {
+    std::future<::Image> image;
+    std::weak_ptr<Texture2D> texture;
+  };
+
+  ImageLoader &loader;
+  std::deque<Queued> queue;
+};
+} // namespace raylib
+
+#endif
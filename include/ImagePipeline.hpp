@@ -0,0 +1,476 @@
+#ifndef RAYLIB_CPP_IMAGEPIPELINE_HPP_
+#define RAYLIB_CPP_IMAGEPIPELINE_HPP_
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+#include "raylib.h"
+#ifdef __cplusplus
+}
+#endif
+
+namespace raylib
+{
+/**
+ * Records a chain of image operations and runs it in as few passes over the pixels as it can.
+ *
+ * Crops, flips, rotations and nearest-neighbour resizes only move pixels, so they fold into one mapping from output
+ * pixel to source pixel, and the color operations work on each pixel wherever it ends up. Everything between two
+ * bicubic Resize() steps, which read whole neighbourhoods and run as they are, becomes one pass over the output in
+ * TILE x TILE tiles with no intermediate image. Each color operation is captured as a table when it is recorded, by
+ * running the raylib function itself on every input it can see, so Run() gives the same pixels as the Image methods
+ * called one by one.
+ *
+ * Only UNCOMPRESSED_R8G8B8A8 images without mipmaps take the fused path. raylib converts other formats back after
+ * every operation, losing precision a single pass would keep, so those run the steps one by one (RunEach()).
+ */
+class ImagePipeline
+{
+public:
+  // Side of the square blocks of output pixels the fused pass fills, so rotated reads stay in cache
+  static constexpr int TILE = 64;
+
+  /**
+   * Crop to a rectangle of whole pixels, clamped to the image as ::ImageCrop() does.
+   */
+  inline ImagePipeline &Crop(::Rectangle crop)
+  {
+    Record(CROP, [crop](::Image *image) { ::ImageCrop(image, crop); }).crop = crop;
+    return *this;
+  }
+  inline ImagePipeline &Resize(int newWidth, int newHeight)
+  {
+    Record(RESIZE, [newWidth, newHeight](::Image *image) { ::ImageResize(image, newWidth, newHeight); });
+    return *this;
+  }
+  inline ImagePipeline &ResizeNN(int newWidth, int newHeight)
+  {
+    Step &step = Record(RESIZE_NN, [newWidth, newHeight](::Image *image) {
+      ::ImageResizeNN(image, newWidth, newHeight);
+    });
+    step.width = newWidth;
+    step.height = newHeight;
+    return *this;
+  }
+  inline ImagePipeline &FlipVertical()
+  {
+    Record(FLIP_VERTICAL, [](::Image *image) { ::ImageFlipVertical(image); });
+    return *this;
+  }
+  inline ImagePipeline &FlipHorizontal()
+  {
+    Record(FLIP_HORIZONTAL, [](::Image *image) { ::ImageFlipHorizontal(image); });
+    return *this;
+  }
+  inline ImagePipeline &RotateCW()
+  {
+    Record(ROTATE_CW, [](::Image *image) { ::ImageRotateCW(image); });
+    return *this;
+  }
+  inline ImagePipeline &RotateCCW()
+  {
+    Record(ROTATE_CCW, [](::Image *image) { ::ImageRotateCCW(image); });
+    return *this;
+  }
+
+  inline ImagePipeline &ColorTint(::Color color)
+  {
+    return Channels([color](::Image *image) { ::ImageColorTint(image, color); });
+  }
+  inline ImagePipeline &ColorInvert()
+  {
+    return Channels([](::Image *image) { ::ImageColorInvert(image); });
+  }
+  inline ImagePipeline &ColorContrast(float contrast)
+  {
+    return Channels([contrast](::Image *image) { ::ImageColorContrast(image, contrast); });
+  }
+  inline ImagePipeline &ColorBrightness(int brightness)
+  {
+    return Channels([brightness](::Image *image) { ::ImageColorBrightness(image, brightness); });
+  }
+  inline ImagePipeline &ColorReplace(::Color color, ::Color replace)
+  {
+    Step &step = Record(REPLACE, [color, replace](::Image *image) { ::ImageColorReplace(image, color, replace); });
+    step.color = color;
+    step.replace = replace;
+    return *this;
+  }
+  inline ImagePipeline &AlphaPremultiply()
+  {
+    Step &step = Record(PREMULTIPLY, [](::Image *image) { ::ImageAlphaPremultiply(image); });
+    step.table = Probe(step.apply, 256);
+    return *this;
+  }
+
+  inline size_t Size() const
+  {
+    return steps.size();
+  }
+
+  inline void Clear()
+  {
+    steps.clear();
+  }
+
+  /**
+   * Apply the recorded steps to image, fusing them where the format allows.
+   */
+  void Run(::Image *image) const
+  {
+    if (image->data == nullptr || image->format != UNCOMPRESSED_R8G8B8A8 || image->mipmaps != 1)
+    {
+      RunEach(image);
+      return;
+    }
+
+    size_t next = 0;
+    while (next < steps.size())
+    {
+      Mapping mapping{image->width, image->height};
+      Pass pass;
+      for (; next < steps.size() && steps[next].kind != RESIZE; ++next)
+      {
+        Fold(steps[next], &mapping, &pass);
+      }
+      Execute(mapping, pass, image);
+      if (next < steps.size())
+      {
+        steps[next++].apply(image);
+      }
+    }
+  }
+
+  /**
+   * Apply the recorded steps one raylib call at a time, the way the Image methods would.
+   */
+  void RunEach(::Image *image) const
+  {
+    for (const Step &step : steps)
+    {
+      step.apply(image);
+    }
+  }
+
+private:
+  enum StepKind
+  {
+    CROP,
+    RESIZE,
+    RESIZE_NN,
+    FLIP_VERTICAL,
+    FLIP_HORIZONTAL,
+    ROTATE_CW,
+    ROTATE_CCW,
+    CHANNELS,
+    REPLACE,
+    PREMULTIPLY
+  };
+
+  struct Step
+  {
+    StepKind kind;
+    std::function<void(::Image *)> apply; // the raylib call, for RunEach() and resizes
+    ::Rectangle crop{};
+    int width = 0;
+    int height = 0;
+    ::Color color{};
+    ::Color replace{};
+    std::vector<unsigned char> table; // CHANNELS and PREMULTIPLY, see Probe()
+  };
+
+  // Where each output pixel comes from: output (x, y) reads source (columns[x], rows[y]), or (rows[y], columns[x])
+  // once a rotation swapped the axes
+  struct Mapping
+  {
+    std::vector<int> columns;
+    std::vector<int> rows;
+    bool transposed = false;
+
+    Mapping(int width, int height) : columns(width), rows(height)
+    {
+      for (int i = 0; i < width; ++i)
+      {
+        columns[i] = i;
+      }
+      for (int i = 0; i < height; ++i)
+      {
+        rows[i] = i;
+      }
+    }
+  };
+
+  // The color steps of a fused pass, in order, with runs of CHANNELS tables merged into one
+  struct Stage
+  {
+    StepKind kind;
+    const unsigned char *table;
+    ::Color color;
+    ::Color replace;
+  };
+  struct Pass
+  {
+    std::vector<Stage> stages;
+    std::vector<std::vector<unsigned char>> merged;
+  };
+
+  std::vector<Step> steps;
+
+  Step &Record(StepKind kind, std::function<void(::Image *)> apply)
+  {
+    steps.emplace_back();
+    steps.back().kind = kind;
+    steps.back().apply = std::move(apply);
+    return steps.back();
+  }
+
+  ImagePipeline &Channels(std::function<void(::Image *)> apply)
+  {
+    Step &step = Record(CHANNELS, std::move(apply));
+    step.table = Probe(step.apply, 1);
+    return *this;
+  }
+
+  // Run a raylib color function on a 256 x height RGBA image whose pixel (x, y) is (x, x, x, x) for height 1, every
+  // value of every channel, or (x, x, x, y) for height 256, every (channel, alpha) pair. The result is the table.
+  static std::vector<unsigned char> Probe(const std::function<void(::Image *)> &apply, int height)
+  {
+    ::Image probe = {RL_MALLOC(256 * height * 4), 256, height, 1, UNCOMPRESSED_R8G8B8A8};
+    unsigned char *pixel = (unsigned char *)probe.data;
+    for (int y = 0; y < height; ++y)
+    {
+      for (int x = 0; x < 256; ++x, pixel += 4)
+      {
+        pixel[0] = pixel[1] = pixel[2] = (unsigned char)x;
+        pixel[3] = (unsigned char)(height == 1 ? x : y);
+      }
+    }
+    apply(&probe);
+    const unsigned char *result = (const unsigned char *)probe.data;
+    std::vector<unsigned char> table(result, result + 256 * height * 4);
+    ::UnloadImage(probe);
+    return table;
+  }
+
+  // Which of size pixels ::ImageResizeNN() picks for each of newSize pixels along an axis, from resizing a row of
+  // pixels that hold their own index
+  static std::vector<int> NearestIndices(int size, int newSize)
+  {
+    ::Image probe = {RL_MALLOC(size * 4), size, 1, 1, UNCOMPRESSED_R8G8B8A8};
+    unsigned char *pixel = (unsigned char *)probe.data;
+    for (int i = 0; i < size; ++i, pixel += 4)
+    {
+      pixel[0] = (unsigned char)i;
+      pixel[1] = (unsigned char)(i >> 8);
+      pixel[2] = (unsigned char)(i >> 16);
+      pixel[3] = 255;
+    }
+    ::ImageResizeNN(&probe, newSize, 1);
+    std::vector<int> indices(newSize);
+    pixel = (unsigned char *)probe.data;
+    for (int i = 0; i < newSize; ++i, pixel += 4)
+    {
+      indices[i] = pixel[0] | pixel[1] << 8 | pixel[2] << 16;
+    }
+    ::UnloadImage(probe);
+    return indices;
+  }
+
+  static void Fold(const Step &step, Mapping *mapping, Pass *pass)
+  {
+    std::vector<int> &columns = mapping->columns;
+    std::vector<int> &rows = mapping->rows;
+    int width = (int)columns.size();
+    int height = (int)rows.size();
+    switch (step.kind)
+    {
+    case CROP:
+    {
+      ::Rectangle crop = step.crop;
+      if (crop.x < 0)
+      {
+        crop.width += crop.x;
+        crop.x = 0;
+      }
+      if (crop.y < 0)
+      {
+        crop.height += crop.y;
+        crop.y = 0;
+      }
+      crop.width = std::min(crop.width, width - crop.x);
+      crop.height = std::min(crop.height, height - crop.y);
+      if (crop.x < width && crop.y < height && (int)crop.width > 0 && (int)crop.height > 0)
+      {
+        columns = std::vector<int>(columns.begin() + (int)crop.x, columns.begin() + (int)crop.x + (int)crop.width);
+        rows = std::vector<int>(rows.begin() + (int)crop.y, rows.begin() + (int)crop.y + (int)crop.height);
+      }
+      break;
+    }
+    case RESIZE_NN:
+    {
+      std::vector<int> pickColumns = NearestIndices(width, step.width);
+      std::vector<int> pickRows = NearestIndices(height, step.height);
+      std::vector<int> newColumns(step.width), newRows(step.height);
+      for (int x = 0; x < step.width; ++x)
+      {
+        newColumns[x] = columns[pickColumns[x]];
+      }
+      for (int y = 0; y < step.height; ++y)
+      {
+        newRows[y] = rows[pickRows[y]];
+      }
+      columns.swap(newColumns);
+      rows.swap(newRows);
+      break;
+    }
+    case FLIP_VERTICAL:
+      std::reverse(rows.begin(), rows.end());
+      break;
+    case FLIP_HORIZONTAL:
+      std::reverse(columns.begin(), columns.end());
+      break;
+    case ROTATE_CW:
+      // Output (x, y) is the previous (y, height - 1 - x)
+      std::reverse(rows.begin(), rows.end());
+      columns.swap(rows);
+      mapping->transposed = !mapping->transposed;
+      break;
+    case ROTATE_CCW:
+      // Output (x, y) is the previous (width - 1 - y, x)
+      std::reverse(columns.begin(), columns.end());
+      columns.swap(rows);
+      mapping->transposed = !mapping->transposed;
+      break;
+    case CHANNELS:
+      if (!pass->stages.empty() && pass->stages.back().kind == CHANNELS)
+      {
+        // Table after table is one table
+        const unsigned char *first = pass->stages.back().table;
+        std::vector<unsigned char> merged(256 * 4);
+        for (int i = 0; i < 256 * 4; ++i)
+        {
+          merged[i] = step.table[first[i] * 4 + i % 4];
+        }
+        pass->merged.push_back(std::move(merged));
+        pass->stages.back().table = pass->merged.back().data();
+        break;
+      }
+      pass->stages.push_back(Stage{CHANNELS, step.table.data(), ::Color{}, ::Color{}});
+      break;
+    case REPLACE:
+    case PREMULTIPLY:
+      pass->stages.push_back(Stage{step.kind, step.table.data(), step.color, step.replace});
+      break;
+    case RESIZE:
+      break;
+    }
+  }
+
+  static void Apply(const Stage &stage, ::Color *pixels, int count)
+  {
+    const unsigned char *table = stage.table;
+    switch (stage.kind)
+    {
+    case CHANNELS:
+      for (int i = 0; i < count; ++i)
+      {
+        ::Color p = pixels[i];
+        pixels[i] = ::Color{table[p.r * 4], table[p.g * 4 + 1], table[p.b * 4 + 2], table[p.a * 4 + 3]};
+      }
+      break;
+    case PREMULTIPLY:
+      for (int i = 0; i < count; ++i)
+      {
+        ::Color p = pixels[i];
+        const unsigned char *row = table + p.a * 256 * 4;
+        pixels[i] = ::Color{row[p.r * 4], row[p.g * 4 + 1], row[p.b * 4 + 2], row[p.r * 4 + 3]};
+      }
+      break;
+    case REPLACE:
+      for (int i = 0; i < count; ++i)
+      {
+        ::Color p = pixels[i];
+        if (p.r == stage.color.r && p.g == stage.color.g && p.b == stage.color.b && p.a == stage.color.a)
+        {
+          pixels[i] = stage.replace;
+        }
+      }
+      break;
+    default:
+      break;
+    }
+  }
+
+  // Fill the output tile by tile: gather each tile row through the mapping, then run the color stages over it
+  static void Execute(const Mapping &mapping, const Pass &pass, ::Image *image)
+  {
+    int width = (int)mapping.columns.size();
+    int height = (int)mapping.rows.size();
+    bool moves = mapping.transposed || width != image->width || height != image->height;
+    for (int i = 0; !moves && i < width; ++i)
+    {
+      moves = mapping.columns[i] != i;
+    }
+    for (int i = 0; !moves && i < height; ++i)
+    {
+      moves = mapping.rows[i] != i;
+    }
+    if (!moves && pass.stages.empty())
+    {
+      return;
+    }
+
+    // Pixels that stay put are recolored in place
+    const ::Color *source = (const ::Color *)image->data;
+    ::Color *target = moves ? (::Color *)RL_MALLOC((size_t)width * height * sizeof(::Color)) : (::Color *)image->data;
+    size_t stride = (size_t)image->width;
+    for (int top = 0; top < height; top += TILE)
+    {
+      for (int left = 0; left < width; left += TILE)
+      {
+        int span = std::min(TILE, width - left);
+        for (int y = top; y < std::min(top + TILE, height); ++y)
+        {
+          ::Color *row = target + (size_t)y * width + left;
+          const int *columns = mapping.columns.data() + left;
+          if (mapping.transposed)
+          {
+            const ::Color *column = source + mapping.rows[y];
+            for (int x = 0; x < span; ++x)
+            {
+              row[x] = column[columns[x] * stride];
+            }
+          }
+          else if (moves)
+          {
+            const ::Color *line = source + mapping.rows[y] * stride;
+            for (int x = 0; x < span; ++x)
+            {
+              row[x] = line[columns[x]];
+            }
+          }
+          for (const Stage &stage : pass.stages)
+          {
+            Apply(stage, row, span);
+          }
+        }
+      }
+    }
+
+    if (moves)
+    {
+      ::UnloadImage(*image);
+      image->data = target;
+      image->width = width;
+      image->height = height;
+    }
+  }
+};
+} // namespace raylib
+
+#endif
@@ -0,0 +1,273 @@
+#ifndef RAYLIB_CPP_MAPPEDIMAGE_HPP_
+#define RAYLIB_CPP_MAPPEDIMAGE_HPP_
+
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#ifdef _WIN32
+#include <vector>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+#include "raylib.h"
+#ifdef __cplusplus
+}
+#endif
+
+namespace raylib
+{
+/**
+ * An image read from a pre-baked .rawimg file by mapping it into memory, so its pixels are used where they lie in
+ * the page cache: no decoding and no copy.
+ *
+ * A .rawimg file is a Header, zero padding up to ALIGNMENT, then the payload: exactly the bytes raylib keeps in
+ * ::Image::data for the header's size, mipmap count and pixel format, compressed formats included, in native byte
+ * order. tools/raw_image_convert.cpp bakes them from PNGs, Export() from any ::Image.
+ *
+ * GetImage() points into the mapping, which is private and copy-on-write: pixels can be changed in place, but the
+ * image must not be handed to anything that frees or replaces its data, e.g. ::UnloadImage() or the raylib functions
+ * that resize or reformat. Copy() gives an image of its own for that. Without mmap (Windows) the file is read into
+ * memory instead.
+ */
+class MappedImage
+{
+public:
+  // Payload alignment in the file, a page, so the payload starts a page of the mapping
+  static const int ALIGNMENT = 4096;
+  static const uint32_t VERSION = 1;
+
+  /**
+   * The start of a .rawimg file, in native byte order.
+   */
+  struct Header
+  {
+    char magic[8]; // "RLIMAGE" and a zero
+    uint32_t version;
+    int32_t width;
+    int32_t height;
+    int32_t mipmaps;
+    int32_t format; // a raylib pixel format
+    uint32_t dataOffset;
+    uint64_t dataSize;
+  };
+
+  MappedImage() = default;
+
+  MappedImage(const std::string &fileName)
+  {
+    Load(fileName);
+  }
+
+  ~MappedImage()
+  {
+    Unload();
+  }
+
+  MappedImage(const MappedImage &) = delete;
+  MappedImage &operator=(const MappedImage &) = delete;
+
+  /**
+   * Map a .rawimg file, false if it can't be read or isn't a valid one.
+   */
+  bool Load(const std::string &fileName)
+  {
+    Unload();
+#ifdef _WIN32
+    FILE *file = std::fopen(fileName.c_str(), "rb");
+    if (file == nullptr)
+    {
+      return false;
+    }
+    std::fseek(file, 0, SEEK_END);
+    long size = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+    if (size > 0)
+    {
+      buffer.resize((size_t)size);
+      if (std::fread(buffer.data(), 1, buffer.size(), file) == buffer.size())
+      {
+        view = buffer.data();
+        viewSize = buffer.size();
+      }
+    }
+    std::fclose(file);
+#else
+    int file = ::open(fileName.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+      return false;
+    }
+    struct stat info;
+    if (::fstat(file, &info) == 0 && info.st_size > 0)
+    {
+      void *mapped = ::mmap(nullptr, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+      if (mapped != MAP_FAILED)
+      {
+        // Start reading the pages in now, the image is about to be used
+        ::madvise(mapped, (size_t)info.st_size, MADV_WILLNEED);
+        view = mapped;
+        viewSize = (size_t)info.st_size;
+      }
+    }
+    // The mapping holds its own reference to the file
+    ::close(file);
+#endif
+
+    Header header;
+    if (view == nullptr || viewSize < sizeof(Header))
+    {
+      Unload();
+      return false;
+    }
+    std::memcpy(&header, view, sizeof(Header));
+    if (!Valid(header, viewSize))
+    {
+      Unload();
+      return false;
+    }
+    image = ::Image{(unsigned char *)view + header.dataOffset, header.width, header.height, header.mipmaps,
+                    header.format};
+    return true;
+  }
+
+  void Unload()
+  {
+#ifdef _WIN32
+    buffer.clear();
+    buffer.shrink_to_fit();
+#else
+    if (view != nullptr)
+    {
+      ::munmap(view, viewSize);
+    }
+#endif
+    view = nullptr;
+    viewSize = 0;
+    image = ::Image{nullptr, 0, 0, 0, 0};
+  }
+
+  inline bool IsReady() const
+  {
+    return image.data != nullptr;
+  }
+
+  /**
+   * The image, its data in the mapping. Valid until Unload() or destruction.
+   */
+  inline const ::Image &GetImage() const
+  {
+    return image;
+  }
+
+  /**
+   * A copy of the image in memory of its own, for ::UnloadImage() to free.
+   */
+  ::Image Copy() const
+  {
+    if (image.data == nullptr)
+    {
+      return image;
+    }
+    size_t size = DataSize(image.width, image.height, image.mipmaps, image.format);
+    ::Image copy = image;
+    copy.data = RL_MALLOC(size);
+    std::memcpy(copy.data, image.data, size);
+    return copy;
+  }
+
+  /**
+   * Write image as a .rawimg file.
+   */
+  static bool Export(const ::Image &image, const std::string &fileName)
+  {
+    if (image.data == nullptr)
+    {
+      return false;
+    }
+    Header header = {{'R', 'L', 'I', 'M', 'A', 'G', 'E', '\0'},
+                     VERSION,
+                     image.width,
+                     image.height,
+                     image.mipmaps,
+                     image.format,
+                     (uint32_t)ALIGNMENT,
+                     DataSize(image.width, image.height, image.mipmaps, image.format)};
+    FILE *file = std::fopen(fileName.c_str(), "wb");
+    if (file == nullptr)
+    {
+      return false;
+    }
+    char padding[ALIGNMENT] = {};
+    bool written = std::fwrite(&header, sizeof(Header), 1, file) == 1 &&
+                   std::fwrite(padding, ALIGNMENT - sizeof(Header), 1, file) == 1 &&
+                   std::fwrite(image.data, (size_t)header.dataSize, 1, file) == 1;
+    return std::fclose(file) == 0 && written;
+  }
+
+  /**
+   * ::LoadImage() that also reads .rawimg files, copied out of the mapping.
+   */
+  static ::Image LoadImage(const std::string &fileName)
+  {
+    if (IsRawFile(fileName))
+    {
+      return MappedImage{fileName}.Copy();
+    }
+    return ::LoadImage(fileName.c_str());
+  }
+
+  static inline bool IsRawFile(const std::string &fileName)
+  {
+    return ::IsFileExtension(fileName.c_str(), ".rawimg");
+  }
+
+  /**
+   * Bytes of a width x height image with mipmaps levels of format, as raylib lays them out. Each level has to fit
+   * raylib's int sizes, which Valid() checks for the headers it reads.
+   */
+  static uint64_t DataSize(int width, int height, int mipmaps, int format)
+  {
+    uint64_t size = 0;
+    for (int level = 0; level < mipmaps; ++level)
+    {
+      // Keeps raylib's rounding, and the 8 or 16 byte minimum of the block-compressed formats below 4x4
+      size += (uint64_t)::GetPixelDataSize(width, height, format);
+      width = width > 1 ? width / 2 : 1;
+      height = height > 1 ? height / 2 : 1;
+    }
+    return size;
+  }
+
+private:
+  void *view = nullptr;
+  size_t viewSize = 0;
+  ::Image image = {nullptr, 0, 0, 0, 0};
+#ifdef _WIN32
+  std::vector<unsigned char> buffer;
+#endif
+
+  static bool Valid(const Header &header, size_t fileSize)
+  {
+    // raylib sizes pixel data as width * height * bits per pixel in an int, at up to 128 bits per pixel
+    return std::memcmp(header.magic, "RLIMAGE", 8) == 0 && header.version == VERSION && header.width > 0 &&
+           header.height > 0 && (uint64_t)header.width * (uint64_t)header.height * 128 <= INT_MAX &&
+           header.mipmaps > 0 && header.mipmaps <= 32 && header.dataOffset >= sizeof(Header) &&
+           header.dataOffset % ALIGNMENT == 0 && header.dataSize > 0 &&
+           header.dataSize == DataSize(header.width, header.height, header.mipmaps, header.format) &&
+           header.dataOffset + header.dataSize <= fileSize;
+  }
+};
+} // namespace raylib
+
+#endif
@@ -13,61 +13,45 @@ extern "C"
 }
 #endif
 
+#include "./raylib-cpp-simd.hpp"
 #include "./raylib-cpp-utils.hpp"
 #ifndef RAYLIB_CPP_NO_MATH
 #include <cmath>
+#include <cstddef>
 #endif
 
 namespace raylib
 {
-class Matrix : public ::Matrix
+/**
+ * Matrix type, 16-byte aligned so its rows load straight into SSE registers. Trivially copyable, and the element-wise
+ * arithmetic and the translate/scale builders are constexpr.
+ */
+class alignas(16) Matrix : public ::Matrix
 {
 public:
-  Matrix(::Matrix mat)
-  {
-    set(mat);
-  };
+  constexpr Matrix(const ::Matrix &mat) : ::Matrix(mat) {}
 
-  Matrix(float M0 = 0, float M1 = 0, float M2 = 0, float M3 = 0, float M4 = 0, float M5 = 0, float M6 = 0, float M7 = 0,
-         float M8 = 0, float M9 = 0, float M10 = 0, float M11 = 0, float M12 = 0, float M13 = 0, float M14 = 0,
-         float M15 = 0)
-  {
-    m0 = M0;
-    m1 = M1;
-    m2 = M2;
-    m3 = M3;
-    m4 = M4;
-    m5 = M5;
-    m6 = M6;
-    m7 = M7;
-    m8 = M8;
-    m9 = M9;
-    m10 = M10;
-    m11 = M11;
-    m12 = M12;
-    m13 = M13;
-    m14 = M14;
-    m15 = M15;
-  };
+  /**
+   * Each M<i> goes to the field m<i>, the arguments are in the order of the float16 array, not the struct fields.
+   */
+  constexpr Matrix(float M0 = 0, float M1 = 0, float M2 = 0, float M3 = 0, float M4 = 0, float M5 = 0, float M6 = 0,
+                   float M7 = 0, float M8 = 0, float M9 = 0, float M10 = 0, float M11 = 0, float M12 = 0, float M13 = 0,
+                   float M14 = 0, float M15 = 0)
+      : ::Matrix{M0, M4, M8, M12, M1, M5, M9, M13, M2, M6, M10, M14, M3, M7, M11, M15}
+  {
+  }
 
-  inline void set(::Matrix mat)
-  {
-    m0 = mat.m0;
-    m1 = mat.m1;
-    m2 = mat.m2;
-    m3 = mat.m3;
-    m4 = mat.m4;
-    m5 = mat.m5;
-    m6 = mat.m6;
-    m7 = mat.m7;
-    m8 = mat.m8;
-    m9 = mat.m9;
-    m10 = mat.m10;
-    m11 = mat.m11;
-    m12 = mat.m12;
-    m13 = mat.m13;
-    m14 = mat.m14;
-    m15 = mat.m15;
+  inline void set(const ::Matrix &mat)
+  {
+#ifdef RAYLIB_CPP_SIMD
+    // Register-wide copies, which the compiler can forward straight from the stores of Multiply() and Invert()
+    for (int i = 0; i < 16; i += simd::WIDTH)
+    {
+      simd::Store(&m0 + i, simd::Load(&mat.m0 + i));
+    }
+#else
+    static_cast<::Matrix &>(*this) = mat;
+#endif
   }
 
   GETTERSETTER(float, M0, m0)
@@ -87,25 +71,28 @@ public:
   GETTERSETTER(float, M14, m14)
   GETTERSETTER(float, M15, m15)
 
+  Matrix(const Matrix &) = default;
+
   Matrix &operator=(const ::Matrix &matrix)
   {
     set(matrix);
     return *this;
   }
 
-  Matrix &operator=(const Matrix &matrix)
-  {
-    set(matrix);
-    return *this;
-  }
+  Matrix &operator=(const Matrix &) = default;
 
-  bool operator==(const Matrix &other)
+  constexpr bool operator==(const ::Matrix &other) const
   {
     return m0 == other.m0 && m1 == other.m1 && m2 == other.m2 && m3 == other.m3 && m4 == other.m4 && m5 == other.m5 &&
            m6 == other.m6 && m7 == other.m7 && m8 == other.m8 && m9 == other.m9 && m10 == other.m10 &&
            m11 == other.m11 && m12 == other.m12 && m13 == other.m13 && m14 == other.m14 && m15 == other.m15;
   }
 
+  constexpr bool operator!=(const ::Matrix &other) const
+  {
+    return !(*this == other);
+  }
+
   inline Matrix &SetProjection()
   {
     ::SetMatrixProjection(*this);
@@ -129,45 +116,58 @@ public:
   }
 
 #ifndef RAYLIB_CPP_NO_MATH
-  float Trace()
+  constexpr float Trace() const
   {
-    return ::MatrixTrace(*this);
+    return m0 + m5 + m10 + m15;
   }
-  Matrix Transpose()
+  constexpr Matrix Transpose() const
   {
-    return ::MatrixTranspose(*this);
+    return Matrix(m0, m4, m8, m12, m1, m5, m9, m13, m2, m6, m10, m14, m3, m7, m11, m15);
   }
-  Matrix Invert()
+  /**
+   * Same as ::MatrixInvert(), on SSE registers where available. A singular matrix gives infinities or NaNs.
+   */
+  Matrix Invert() const
   {
+#ifdef __SSE2__
+    Matrix result{Uninitialized{}};
+    InvertRows(&m0, &result.m0);
+    return result;
+#else
     return ::MatrixInvert(*this);
+#endif
   }
-  Matrix Normalize()
+  Matrix Normalize() const
   {
     return ::MatrixNormalize(*this);
   }
-  static Matrix Identity()
+  static constexpr Matrix Identity()
   {
-    return ::MatrixIdentity();
+    return Matrix(1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1);
   }
-  Matrix Add(::Matrix right)
+  constexpr Matrix Add(const ::Matrix &right) const
   {
-    return ::MatrixAdd(*this, right);
+    return Matrix(m0 + right.m0, m1 + right.m1, m2 + right.m2, m3 + right.m3, m4 + right.m4, m5 + right.m5,
+                  m6 + right.m6, m7 + right.m7, m8 + right.m8, m9 + right.m9, m10 + right.m10, m11 + right.m11,
+                  m12 + right.m12, m13 + right.m13, m14 + right.m14, m15 + right.m15);
   }
-  Matrix operator+(const Matrix &matrix)
+  constexpr Matrix operator+(const ::Matrix &matrix) const
   {
-    return ::MatrixAdd(*this, matrix);
+    return Add(matrix);
   }
-  Matrix Subtract(::Matrix right)
+  constexpr Matrix Subtract(const ::Matrix &right) const
   {
-    return ::MatrixSubtract(*this, right);
+    return Matrix(m0 - right.m0, m1 - right.m1, m2 - right.m2, m3 - right.m3, m4 - right.m4, m5 - right.m5,
+                  m6 - right.m6, m7 - right.m7, m8 - right.m8, m9 - right.m9, m10 - right.m10, m11 - right.m11,
+                  m12 - right.m12, m13 - right.m13, m14 - right.m14, m15 - right.m15);
   }
-  Matrix operator-(const Matrix &matrix)
+  constexpr Matrix operator-(const ::Matrix &matrix) const
   {
-    return ::MatrixSubtract(*this, matrix);
+    return Subtract(matrix);
   }
-  static Matrix Translate(float x, float y, float z)
+  static constexpr Matrix Translate(float x, float y, float z)
   {
-    return ::MatrixTranslate(x, y, z);
+    return Matrix(1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, x, y, z, 1);
   }
   static Matrix Rotate(Vector3 axis, float angle)
   {
@@ -189,17 +189,88 @@ public:
   {
     return ::MatrixRotateZ(angle);
   }
-  static Matrix Scale(float x, float y, float z)
+  static constexpr Matrix Scale(float x, float y, float z)
   {
-    return ::MatrixScale(x, y, z);
+    return Matrix(x, 0, 0, 0, 0, y, 0, 0, 0, 0, z, 0, 0, 0, 0, 1);
   }
-  Matrix Multiply(Matrix right)
+  /**
+   * Same as ::MatrixMultiply(*this, right): transforming by the result is transforming by *this, then by right.
+   */
+  Matrix Multiply(const ::Matrix &right) const
   {
+#ifdef __SSE2__
+    Matrix result{Uninitialized{}};
+    MultiplyRows(&m0, &right.m0, &result.m0);
+    return result;
+#else
     return ::MatrixMultiply(*this, right);
+#endif
   }
-  Matrix operator*(const Matrix &matrix)
+  Matrix operator*(const Matrix &matrix) const
   {
-    return ::MatrixMultiply(*this, matrix);
+    return Multiply(matrix);
+  }
+
+  /**
+   * Transform count points by this matrix, out[i] = ::Vector3Transform(in[i], *this). out may be the same array as in.
+   */
+  void Transform(const ::Vector3 *in, ::Vector3 *out, size_t count) const
+  {
+    const float *pi = &in->x;
+    float *po = &out->x;
+    size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+    simd::Lane c0 = simd::Set(m0), c4 = simd::Set(m4), c8 = simd::Set(m8), c12 = simd::Set(m12);
+    simd::Lane c1 = simd::Set(m1), c5 = simd::Set(m5), c9 = simd::Set(m9), c13 = simd::Set(m13);
+    simd::Lane c2 = simd::Set(m2), c6 = simd::Set(m6), c10 = simd::Set(m10), c14 = simd::Set(m14);
+    for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+    {
+      simd::Lane x, y, z;
+      simd::Load3(pi + 3 * i, &x, &y, &z);
+      simd::Store3(po + 3 * i, Row(c0, c4, c8, x, y, z, c12), Row(c1, c5, c9, x, y, z, c13),
+                   Row(c2, c6, c10, x, y, z, c14));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+      float x = pi[3 * i], y = pi[3 * i + 1], z = pi[3 * i + 2];
+      po[3 * i] = m0 * x + m4 * y + m8 * z + m12;
+      po[3 * i + 1] = m1 * x + m5 * y + m9 * z + m13;
+      po[3 * i + 2] = m2 * x + m6 * y + m10 * z + m14;
+    }
+  }
+
+  /**
+   * Transform count vectors by this matrix, w included, out[i] = ::QuaternionTransform(in[i], *this). out may be the
+   * same array as in.
+   */
+  void Transform(const ::Vector4 *in, ::Vector4 *out, size_t count) const
+  {
+    const float *pi = &in->x;
+    float *po = &out->x;
+    size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+    simd::Lane c0 = simd::Set(m0), c4 = simd::Set(m4), c8 = simd::Set(m8), c12 = simd::Set(m12);
+    simd::Lane c1 = simd::Set(m1), c5 = simd::Set(m5), c9 = simd::Set(m9), c13 = simd::Set(m13);
+    simd::Lane c2 = simd::Set(m2), c6 = simd::Set(m6), c10 = simd::Set(m10), c14 = simd::Set(m14);
+    simd::Lane c3 = simd::Set(m3), c7 = simd::Set(m7), c11 = simd::Set(m11), c15 = simd::Set(m15);
+    for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+    {
+      simd::Lane x, y, z, w;
+      simd::Load4(pi + 4 * i, &x, &y, &z, &w);
+      simd::Store4(po + 4 * i, Row(c0, c4, c8, x, y, z, simd::Mul(c12, w)),
+                   Row(c1, c5, c9, x, y, z, simd::Mul(c13, w)), Row(c2, c6, c10, x, y, z, simd::Mul(c14, w)),
+                   Row(c3, c7, c11, x, y, z, simd::Mul(c15, w)));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+      float x = pi[4 * i], y = pi[4 * i + 1], z = pi[4 * i + 2], w = pi[4 * i + 3];
+      po[4 * i] = m0 * x + m4 * y + m8 * z + m12 * w;
+      po[4 * i + 1] = m1 * x + m5 * y + m9 * z + m13 * w;
+      po[4 * i + 2] = m2 * x + m6 * y + m10 * z + m14 * w;
+      po[4 * i + 3] = m3 * x + m7 * y + m11 * z + m15 * w;
+    }
   }
 
   static Matrix Frustum(double left, double right, double bottom, double top, double near, double far)
@@ -222,14 +293,183 @@ public:
     return ::MatrixLookAt(eye, target, up);
   }
 
-  float16 ToFloatV()
+  float16 ToFloatV() const
   {
     return ::MatrixToFloatV(*this);
   }
-  operator float16()
+  operator float16() const
   {
     return ToFloatV();
   }
+
+private:
+  // Skips zeroing a result that the SIMD code overwrites in full
+  struct Uninitialized
+  {
+  };
+  Matrix(Uninitialized) {}
+
+#ifdef RAYLIB_CPP_SIMD
+  // a * x + b * y + c * z + d, added up in the same order as raymath does
+  static inline simd::Lane Row(simd::Lane a, simd::Lane b, simd::Lane c, simd::Lane x, simd::Lane y, simd::Lane z,
+                               simd::Lane d)
+  {
+    return simd::Add(simd::Add(simd::Add(simd::Mul(a, x), simd::Mul(b, y)), simd::Mul(c, z)), d);
+  }
+#endif
+
+#ifdef __SSE2__
+  // ::Matrix keeps m0, m4, m8, m12 first, so as 16 floats it is four rows of the matrix that multiplies column vectors
+
+  template <int X, int Y, int Z, int W> static inline __m128 Shuffle(__m128 a, __m128 b)
+  {
+    return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+  }
+
+  template <int X, int Y, int Z, int W> static inline __m128 Swizzle(__m128 a)
+  {
+    return _mm_shuffle_ps(a, a, _MM_SHUFFLE(W, Z, Y, X));
+  }
+
+  // ::MatrixMultiply(left, right) is right * left in those rows: each row of the result is the left rows weighted by
+  // the matching row of right
+  static void MultiplyRows(const float *left, const float *right, float *out)
+  {
+#ifdef __AVX2__
+    // Two rows of the result per register, both halves holding the left rows
+    __m256 l0 = _mm256_broadcast_ps((const __m128 *)left);
+    __m256 l1 = _mm256_broadcast_ps((const __m128 *)(left + 4));
+    __m256 l2 = _mm256_broadcast_ps((const __m128 *)(left + 8));
+    __m256 l3 = _mm256_broadcast_ps((const __m128 *)(left + 12));
+    __m256 top = WeightRows(right, l0, l1, l2, l3);
+    __m256 bottom = WeightRows(right + 8, l0, l1, l2, l3);
+#ifdef __AVX512F__
+    __m512d rows = _mm512_castpd256_pd512(_mm256_castps_pd(top));
+    StoreRows(out, _mm512_castpd_ps(_mm512_insertf64x4(rows, _mm256_castps_pd(bottom), 1)));
+#else
+    StoreRows(out, _mm256_castps256_ps128(top), _mm256_extractf128_ps(top, 1), _mm256_castps256_ps128(bottom),
+              _mm256_extractf128_ps(bottom, 1));
+#endif
+#else
+    __m128 l0 = _mm_loadu_ps(left);
+    __m128 l1 = _mm_loadu_ps(left + 4);
+    __m128 l2 = _mm_loadu_ps(left + 8);
+    __m128 l3 = _mm_loadu_ps(left + 12);
+    StoreRows(out, WeightRows(right, l0, l1, l2, l3), WeightRows(right + 4, l0, l1, l2, l3),
+              WeightRows(right + 8, l0, l1, l2, l3), WeightRows(right + 12, l0, l1, l2, l3));
+#endif
+  }
+
+#ifdef __AVX2__
+  static inline __m256 WeightRows(const float *weights, __m256 r0, __m256 r1, __m256 r2, __m256 r3)
+  {
+    __m256 w = _mm256_loadu_ps(weights);
+    __m256 sum =
+        _mm256_add_ps(_mm256_mul_ps(_mm256_permute_ps(w, 0x00), r0), _mm256_mul_ps(_mm256_permute_ps(w, 0x55), r1));
+    sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_permute_ps(w, 0xaa), r2));
+    return _mm256_add_ps(sum, _mm256_mul_ps(_mm256_permute_ps(w, 0xff), r3));
+  }
+#endif
+
+  static inline __m128 WeightRows(const float *weights, __m128 r0, __m128 r1, __m128 r2, __m128 r3)
+  {
+    __m128 sum = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(weights[0]), r0), _mm_mul_ps(_mm_set1_ps(weights[1]), r1));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[2]), r2));
+    return _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[3]), r3));
+  }
+
+  // 2x2 matrices as (a b c d) for | a b |, the product a * b
+  //                                | c d |
+  static inline __m128 Mul2(__m128 a, __m128 b)
+  {
+    return _mm_add_ps(_mm_mul_ps(a, Swizzle<0, 3, 0, 3>(b)), _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+  }
+
+  // adjugate(a) * b
+  static inline __m128 AdjMul2(__m128 a, __m128 b)
+  {
+    return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(a), b), _mm_mul_ps(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+  }
+
+  // a * adjugate(b)
+  static inline __m128 MulAdj2(__m128 a, __m128 b)
+  {
+    return _mm_sub_ps(_mm_mul_ps(a, Swizzle<3, 0, 3, 0>(b)), _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+  }
+
+  // Inverse by 2x2 blocks | A B |, the inverse of the transpose being the transpose of the inverse
+  //                       | C D |
+  static void InvertRows(const float *in, float *out)
+  {
+    __m128 r0 = _mm_loadu_ps(in);
+    __m128 r1 = _mm_loadu_ps(in + 4);
+    __m128 r2 = _mm_loadu_ps(in + 8);
+    __m128 r3 = _mm_loadu_ps(in + 12);
+
+    __m128 a = _mm_movelh_ps(r0, r1);
+    __m128 b = _mm_movehl_ps(r1, r0);
+    __m128 c = _mm_movelh_ps(r2, r3);
+    __m128 d = _mm_movehl_ps(r3, r2);
+
+    // (|A| |B| |C| |D|)
+    __m128 det = _mm_sub_ps(_mm_mul_ps(Shuffle<0, 2, 0, 2>(r0, r2), Shuffle<1, 3, 1, 3>(r1, r3)),
+                            _mm_mul_ps(Shuffle<1, 3, 1, 3>(r0, r2), Shuffle<0, 2, 0, 2>(r1, r3)));
+    __m128 detA = Swizzle<0, 0, 0, 0>(det);
+    __m128 detB = Swizzle<1, 1, 1, 1>(det);
+    __m128 detC = Swizzle<2, 2, 2, 2>(det);
+    __m128 detD = Swizzle<3, 3, 3, 3>(det);
+
+    // The inverse is | X Y | / |M|, built from adjugates of the blocks
+    //                | Z W |
+    __m128 dc = AdjMul2(d, c);
+    __m128 ab = AdjMul2(a, b);
+    __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Mul2(b, dc));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Mul2(c, ab));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), MulAdj2(d, ab));
+    __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), MulAdj2(a, dc));
+
+    // |M| = |A| |D| + |B| |C| - trace(adjugate(A) B adjugate(D) C)
+    __m128 trace = _mm_mul_ps(ab, Swizzle<0, 2, 1, 3>(dc));
+    trace = _mm_add_ps(trace, Swizzle<1, 0, 3, 2>(trace));
+    trace = _mm_add_ps(trace, Swizzle<2, 3, 0, 1>(trace));
+    __m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+    __m128 scale = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+    x = _mm_mul_ps(x, scale);
+    y = _mm_mul_ps(y, scale);
+    z = _mm_mul_ps(z, scale);
+    w = _mm_mul_ps(w, scale);
+
+    // Adjugate the blocks back while putting them in place
+    StoreRows(out, Shuffle<3, 1, 3, 1>(x, y), Shuffle<2, 0, 2, 0>(x, y), Shuffle<3, 1, 3, 1>(z, w),
+              Shuffle<2, 0, 2, 0>(z, w));
+  }
+
+  // The results of Multiply() and Invert() are usually copied right away, by the compiler's own trivial copy: 64 bytes
+  // at once with AVX-512, 16 at a time otherwise. Storing them in the same pieces lets the copy read them back from
+  // the store buffer instead of stalling
+  static inline void StoreRows(float *out, __m128 r0, __m128 r1, __m128 r2, __m128 r3)
+  {
+#ifdef __AVX512F__
+    __m512 rows = _mm512_castps128_ps512(r0);
+    rows = _mm512_insertf32x4(rows, r1, 1);
+    rows = _mm512_insertf32x4(rows, r2, 2);
+    StoreRows(out, _mm512_insertf32x4(rows, r3, 3));
+#else
+    _mm_storeu_ps(out, r0);
+    _mm_storeu_ps(out + 4, r1);
+    _mm_storeu_ps(out + 8, r2);
+    _mm_storeu_ps(out + 12, r3);
+#endif
+  }
+
+#ifdef __AVX512F__
+  static inline void StoreRows(float *out, __m512 rows)
+  {
+    _mm512_storeu_ps(out, rows);
+  }
+#endif
+#endif
 #endif
 };
 } // namespace raylib
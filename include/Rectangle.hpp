@@ -15,22 +15,18 @@ extern "C"
 
 namespace raylib
 {
+/**
+ * Rectangle type. Trivially copyable and constexpr-constructible, so rectangles can be game constants.
+ */
 class Rectangle : public ::Rectangle
 {
 public:
-  Rectangle(::Rectangle vec)
+  constexpr Rectangle(const ::Rectangle &vec) : ::Rectangle{vec.x, vec.y, vec.width, vec.height} {}
+  constexpr Rectangle(float X = 0, float Y = 0, float Width = 0, float Height = 0) : ::Rectangle{X, Y, Width, Height}
   {
-    set(vec);
-  };
-  Rectangle(float X = 0, float Y = 0, float Width = 0, float Height = 0)
-  {
-    x = X;
-    y = Y;
-    width = Width;
-    height = Height;
-  };
+  }
 
-  inline void set(::Rectangle rect)
+  constexpr void set(const ::Rectangle &rect)
   {
     x = rect.x;
     y = rect.y;
@@ -43,13 +39,7 @@ public:
   GETTERSETTER(float, Width, width)
   GETTERSETTER(float, Height, height)
 
-  Rectangle &operator=(const ::Rectangle &rect)
-  {
-    set(rect);
-    return *this;
-  }
-
-  Rectangle &operator=(const Rectangle &rect)
+  constexpr Rectangle &operator=(const ::Rectangle &rect)
   {
     set(rect);
     return *this;
@@ -105,15 +95,15 @@ public:
     return *this;
   }
 
-  inline bool CheckCollision(::Rectangle rec2)
+  inline bool CheckCollision(::Rectangle rec2) const
   {
     return ::CheckCollisionRecs(*this, rec2);
   }
-  inline Rectangle GetCollision(::Rectangle rec2)
+  inline Rectangle GetCollision(::Rectangle rec2) const
   {
     return ::GetCollisionRec(*this, rec2);
   }
-  inline bool CheckCollision(::Vector2 point)
+  inline bool CheckCollision(::Vector2 point) const
   {
     return ::CheckCollisionPointRec(point, *this);
   }
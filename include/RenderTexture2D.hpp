@@ -39,8 +39,8 @@ public:
   }
 
   GETTERSETTER(unsigned int, Id, id)
-  GETTERSETTER(Texture2D, Texture, texture)
-  GETTERSETTER(Texture2D, Depth, depth)
+  GETTERSETTER(::Texture2D, Texture, texture)
+  GETTERSETTER(::Texture2D, Depth, depth)
   // GETTERSETTER(bool, DepthTexture, depthTexture)
 
   RenderTexture2D &operator=(const ::RenderTexture2D &texture)
@@ -0,0 +1,694 @@
+#ifndef RAYLIB_CPP_SOFTWARERENDERER_HPP_
+#define RAYLIB_CPP_SOFTWARERENDERER_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+#include "raylib.h"
+#ifdef __cplusplus
+}
+#endif
+
+#include "./ColorBatch.hpp"
+#include "./SpriteBatch.hpp"
+#include "./ThreadPool.hpp"
+
+namespace raylib
+{
+/**
+ * Draws 2D frames into an RGBA image on the CPU, for rendering without a window or a GPU.
+ *
+ * The drawing functions take the same arguments as the raylib functions they are named after, and cover what the
+ * games draw: filled, outlined and gradient rectangles, lines, circles, textured quads with rotation, scale and tint,
+ * and text. They only record a command. Render() bins the commands into TILE x TILE tiles and rasterizes the tiles
+ * independently, on a ThreadPool when given one, so every tile sees its commands in drawing order and the frame is
+ * the same however the tiles are spread over threads. Spans are tinted and alpha blended with the ColorBatch
+ * kernels.
+ *
+ * Pixels are covered when their center is inside the shape, and textures are sampled nearest, as with raylib's
+ * default texture filter. Blending is ColorBatch::AlphaBlend(), ::ColorAlphaBlend() on every channel.
+ *
+ * There is no GPU to hold textures, so the pixels behind every texture id are handed over with SetTexture(), and text
+ * needs a font whose glyph images are loaded, such as one built from ::LoadFontData(). Neither may change between
+ * drawing and Render().
+ */
+class SoftwareRenderer
+{
+public:
+  // Side of the square blocks of pixels Render() rasterizes independently
+  static const int TILE = 64;
+
+  /**
+   * Create a width x height target, transparent black until the first ClearBackground().
+   */
+  SoftwareRenderer(int width, int height)
+  {
+    target = {RL_MALLOC((size_t)width * height * sizeof(::Color)), width, height, 1, UNCOMPRESSED_R8G8B8A8};
+    std::memset(target.data, 0, (size_t)width * height * sizeof(::Color));
+  }
+
+  ~SoftwareRenderer()
+  {
+    ::UnloadImage(target);
+    for (auto &texture : textures)
+    {
+      ::UnloadImage(texture.second);
+    }
+    UnloadFont();
+  }
+
+  SoftwareRenderer(const SoftwareRenderer &) = delete;
+  SoftwareRenderer &operator=(const SoftwareRenderer &) = delete;
+
+  inline int Width() const
+  {
+    return target.width;
+  }
+
+  inline int Height() const
+  {
+    return target.height;
+  }
+
+  /**
+   * The frame as of the last Render().
+   */
+  inline const ::Image &GetImage() const
+  {
+    return target;
+  }
+
+  /**
+   * Draw texture with a copy of pixels, converted to RGBA.
+   */
+  void SetTexture(const ::Texture2D &texture, const ::Image &pixels)
+  {
+    auto found = textures.find(texture.id);
+    if (found != textures.end())
+    {
+      ::UnloadImage(found->second);
+    }
+    textures[texture.id] = ToRGBA(pixels);
+  }
+
+  /**
+   * Draw text with font, which needs its glyph images (font.chars[i].image). The glyphs are copied.
+   */
+  void SetFont(const ::Font &font)
+  {
+    UnloadFont();
+    baseSize = font.baseSize;
+    std::fill(glyphOf, glyphOf + 256, 0);
+    for (int i = 0; i < font.charsCount; ++i)
+    {
+      const ::CharInfo &info = font.chars[i];
+      glyphs.push_back(Glyph{ToRGBA(info.image), font.recs[i].width, font.recs[i].height, info.offsetX, info.offsetY,
+                             info.advanceX});
+      if (info.value >= 0 && info.value < 256)
+      {
+        glyphOf[info.value] = i;
+      }
+    }
+  }
+
+  /**
+   * Drop everything drawn since the last Render() and fill the frame with color.
+   */
+  inline SoftwareRenderer &ClearBackground(::Color color)
+  {
+    commands.clear();
+    Command command{CLEAR};
+    command.color = color;
+    Push(command, 0, 0, (float)target.width, (float)target.height);
+    return *this;
+  }
+
+  inline SoftwareRenderer &DrawRectangle(::Rectangle rec, ::Color color)
+  {
+    Command command{FILL};
+    command.color = color;
+    Push(command, rec.x, rec.y, rec.x + rec.width, rec.y + rec.height);
+    return *this;
+  }
+
+  inline SoftwareRenderer &DrawRectangle(int posX, int posY, int width, int height, ::Color color)
+  {
+    return DrawRectangle(::Rectangle{(float)posX, (float)posY, (float)width, (float)height}, color);
+  }
+
+  /**
+   * Draw a one pixel outline just inside rec.
+   */
+  inline SoftwareRenderer &DrawRectangleLines(::Rectangle rec, ::Color color)
+  {
+    DrawRectangle(::Rectangle{rec.x, rec.y, rec.width, 1}, color);
+    DrawRectangle(::Rectangle{rec.x, rec.y + rec.height - 1, rec.width, 1}, color);
+    DrawRectangle(::Rectangle{rec.x, rec.y + 1, 1, rec.height - 2}, color);
+    return DrawRectangle(::Rectangle{rec.x + rec.width - 1, rec.y + 1, 1, rec.height - 2}, color);
+  }
+
+  /**
+   * Draw rec shading from top to bottom.
+   */
+  inline SoftwareRenderer &DrawRectangleGradientV(::Rectangle rec, ::Color top, ::Color bottom)
+  {
+    return Gradient(GRADIENT_V, rec, top, bottom);
+  }
+
+  /**
+   * Draw rec shading from left to right.
+   */
+  inline SoftwareRenderer &DrawRectangleGradientH(::Rectangle rec, ::Color left, ::Color right)
+  {
+    return Gradient(GRADIENT_H, rec, left, right);
+  }
+
+  /**
+   * Draw a one pixel wide line.
+   */
+  inline SoftwareRenderer &DrawLine(::Vector2 start, ::Vector2 end, ::Color color)
+  {
+    float length = sqrtf((end.x - start.x) * (end.x - start.x) + (end.y - start.y) * (end.y - start.y));
+    return Quad(nullptr, ::Rectangle{}, ::Rectangle{start.x, start.y, length, 1.0f}, ::Vector2{0, 0.5f},
+                atan2f(end.y - start.y, end.x - start.x) * RAD2DEG, color);
+  }
+
+  inline SoftwareRenderer &DrawCircle(::Vector2 center, float radius, ::Color color)
+  {
+    return DrawCircleGradient(center, radius, color, color);
+  }
+
+  /**
+   * Draw a circle shading from inner at the center to outer at the edge.
+   */
+  inline SoftwareRenderer &DrawCircleGradient(::Vector2 center, float radius, ::Color inner, ::Color outer)
+  {
+    Command command{CIRCLE};
+    command.color = inner;
+    command.color2 = outer;
+    command.x = center.x;
+    command.y = center.y;
+    command.width = radius;
+    Push(command, center.x - radius, center.y - radius, center.x + radius, center.y + radius);
+    return *this;
+  }
+
+  /**
+   * Draw part of a texture, as ::DrawTexturePro() would.
+   */
+  inline SoftwareRenderer &DrawTexture(const ::Texture2D &texture, ::Rectangle sourceRec, ::Rectangle destRec,
+                                       ::Vector2 origin, float rotation = 0, ::Color tint = WHITE)
+  {
+    auto found = textures.find(texture.id);
+    if (found == textures.end())
+    {
+      return *this;
+    }
+    return Quad(&found->second, sourceRec, destRec, origin, rotation, tint);
+  }
+
+  /**
+   * Draw a texture, as ::DrawTextureEx() would.
+   */
+  inline SoftwareRenderer &DrawTexture(const ::Texture2D &texture, ::Vector2 position, float rotation,
+                                       float scale = 1.0f, ::Color tint = WHITE)
+  {
+    return DrawTexture(texture, ::Rectangle{0, 0, (float)texture.width, (float)texture.height},
+                       ::Rectangle{position.x, position.y, texture.width * scale, texture.height * scale},
+                       ::Vector2{0, 0}, rotation, tint);
+  }
+
+  /**
+   * Draw a texture, as ::DrawTextureV() would.
+   */
+  inline SoftwareRenderer &DrawTexture(const ::Texture2D &texture, ::Vector2 position, ::Color tint = WHITE)
+  {
+    return DrawTexture(texture, position, 0, 1.0f, tint);
+  }
+
+  /**
+   * Draw the quads of one texture, fits SpriteBatch::Flush(submit).
+   */
+  SoftwareRenderer &Draw(const ::Texture2D &texture, const SpriteBatch::Quad *quads, int count)
+  {
+    for (int i = 0; i < count; ++i)
+    {
+      DrawTexture(texture, quads[i].source, quads[i].dest, quads[i].origin, quads[i].rotation, quads[i].tint);
+    }
+    return *this;
+  }
+
+  /**
+   * Draw text with the font from SetFont(), as ::DrawText() does with the default font.
+   */
+  SoftwareRenderer &DrawText(const char *text, int posX, int posY, int fontSize, ::Color color)
+  {
+    if (glyphs.empty())
+    {
+      return *this;
+    }
+    fontSize = fontSize < DEFAULT_FONT_SIZE ? DEFAULT_FONT_SIZE : fontSize;
+    float scale = (float)fontSize / baseSize;
+    float spacing = (float)(fontSize / DEFAULT_FONT_SIZE);
+    float x = 0.0f;
+    float y = 0.0f;
+    for (const unsigned char *c = (const unsigned char *)text; *c != '\0'; ++c)
+    {
+      if (*c == '\n')
+      {
+        y += (int)((baseSize + baseSize / 2) * scale);
+        x = 0.0f;
+        continue;
+      }
+      const Glyph &glyph = glyphs[glyphOf[*c]];
+      if (*c != ' ' && *c != '\t')
+      {
+        Quad(&glyph.image, ::Rectangle{0, 0, glyph.width, glyph.height},
+             ::Rectangle{posX + x + glyph.offsetX * scale, posY + y + glyph.offsetY * scale, glyph.width * scale,
+                         glyph.height * scale},
+             ::Vector2{0, 0}, 0, color);
+      }
+      x += (glyph.advanceX == 0 ? glyph.width : (float)glyph.advanceX) * scale + spacing;
+    }
+    return *this;
+  }
+
+  /**
+   * Width of text drawn with DrawText(), as ::MeasureText() gives it for the default font.
+   */
+  int MeasureText(const char *text, int fontSize) const
+  {
+    if (glyphs.empty())
+    {
+      return 0;
+    }
+    fontSize = fontSize < DEFAULT_FONT_SIZE ? DEFAULT_FONT_SIZE : fontSize;
+    float width = 0.0f, widest = 0.0f;
+    int length = 0, longest = 0;
+    for (const unsigned char *c = (const unsigned char *)text; *c != '\0'; ++c)
+    {
+      if (*c == '\n')
+      {
+        widest = std::max(widest, width);
+        longest = std::max(longest, length);
+        width = 0.0f;
+        length = 0;
+        continue;
+      }
+      const Glyph &glyph = glyphs[glyphOf[*c]];
+      width += glyph.advanceX != 0 ? (float)glyph.advanceX : glyph.width + glyph.offsetX;
+      length++;
+    }
+    widest = std::max(widest, width);
+    longest = std::max(longest, length);
+    return (int)(widest * fontSize / baseSize + (float)((longest - 1) * (fontSize / DEFAULT_FONT_SIZE)));
+  }
+
+  /**
+   * Rasterize everything drawn since the last Render() on the calling thread.
+   */
+  inline SoftwareRenderer &Render()
+  {
+    Bin();
+    RenderTiles(0, 1);
+    commands.clear();
+    return *this;
+  }
+
+  /**
+   * Rasterize everything drawn since the last Render(), the tiles shared between the pool and the calling thread.
+   */
+  SoftwareRenderer &Render(ThreadPool &pool)
+  {
+    Bin();
+    int bands = std::min(pool.Workers() + 1, (int)bins.size());
+    pool.ParallelFor(bands, [this, bands](int band) { RenderTiles(band, bands); });
+    commands.clear();
+    return *this;
+  }
+
+private:
+  // ::DrawText() scales the default font from this size
+  static const int DEFAULT_FONT_SIZE = 10;
+
+  enum CommandKind
+  {
+    CLEAR,
+    FILL,
+    GRADIENT_V,
+    GRADIENT_H,
+    CIRCLE,
+    QUAD
+  };
+
+  struct Command
+  {
+    CommandKind kind;
+    int left = 0, top = 0, right = 0, bottom = 0; // pixels it can cover, clipped to the target
+    ::Color color{};                              // fill, first gradient color, inner circle color or tint
+    ::Color color2{};                             // last gradient color or outer circle color
+    const ::Image *texels = nullptr;              // QUAD, none for a solid quad
+
+    // GRADIENT: the rectangle. CIRCLE: center and radius (width). QUAD: dest position and size.
+    float x = 0, y = 0, width = 0, height = 0;
+
+    // QUAD: the local position of a pixel is (cosine, sine) dot its offset from dest, plus origin, and the texel
+    // under it is (u0, v0) + local * (du, dv), clamped to [uMin, uMax] x [vMin, vMax]
+    float cosine = 1, sine = 0, originX = 0, originY = 0;
+    float u0 = 0, du = 0, v0 = 0, dv = 0;
+    int uMin = 0, uMax = 0, vMin = 0, vMax = 0;
+  };
+
+  struct Glyph
+  {
+    ::Image image;
+    float width, height;
+    int offsetX, offsetY, advanceX;
+  };
+
+  ::Image target;
+  std::vector<Command> commands;
+  std::vector<std::vector<int>> bins; // command indices per tile, row by row
+  std::unordered_map<unsigned int, ::Image> textures;
+  std::vector<Glyph> glyphs;
+  int glyphOf[256] = {};
+  int baseSize = DEFAULT_FONT_SIZE;
+
+  static ::Image ToRGBA(const ::Image &image)
+  {
+    ::Image copy = ::ImageCopy(image);
+    ::ImageFormat(&copy, UNCOMPRESSED_R8G8B8A8);
+    return copy;
+  }
+
+  void UnloadFont()
+  {
+    for (Glyph &glyph : glyphs)
+    {
+      ::UnloadImage(glyph.image);
+    }
+    glyphs.clear();
+  }
+
+  // Keep command if it can cover any pixel whose center is in [left, right) x [top, bottom)
+  void Push(Command &command, float left, float top, float right, float bottom)
+  {
+    auto pixel = [](float edge, int size) { return (int)ceilf(std::min(std::max(edge - 0.5f, 0.0f), (float)size)); };
+    command.left = pixel(left, target.width);
+    command.right = pixel(right, target.width);
+    command.top = pixel(top, target.height);
+    command.bottom = pixel(bottom, target.height);
+    if (command.left < command.right && command.top < command.bottom &&
+        (command.kind == CLEAR || command.color.a > 0 || command.color2.a > 0))
+    {
+      commands.push_back(command);
+    }
+  }
+
+  SoftwareRenderer &Gradient(CommandKind kind, ::Rectangle rec, ::Color first, ::Color last)
+  {
+    Command command{kind};
+    command.color = first;
+    command.color2 = last;
+    command.x = rec.x;
+    command.y = rec.y;
+    command.width = rec.width;
+    command.height = rec.height;
+    Push(command, rec.x, rec.y, rec.x + rec.width, rec.y + rec.height);
+    return *this;
+  }
+
+  // A ::DrawTexturePro() quad of texels, or a solid one in tint without
+  SoftwareRenderer &Quad(const ::Image *texels, ::Rectangle source, ::Rectangle dest, ::Vector2 origin,
+                         float rotation, ::Color tint)
+  {
+    if (dest.width <= 0 || dest.height <= 0)
+    {
+      return *this;
+    }
+    Command command{QUAD};
+    command.color = tint;
+    command.texels = texels;
+    command.x = dest.x;
+    command.y = dest.y;
+    command.width = dest.width;
+    command.height = dest.height;
+    command.originX = origin.x;
+    command.originY = origin.y;
+    command.cosine = cosf(rotation * DEG2RAD);
+    command.sine = sinf(rotation * DEG2RAD);
+    if (texels != nullptr)
+    {
+      // A negative width mirrors the source, a negative height flips it, as in ::DrawTexturePro()
+      command.u0 = source.width < 0 ? source.x - source.width : source.x;
+      command.du = source.width / dest.width;
+      command.v0 = source.height < 0 ? source.y - source.height : source.y;
+      command.dv = source.height / dest.height;
+      float u1 = command.u0 + source.width;
+      float v1 = command.v0 + source.height;
+      command.uMin = std::max(0, (int)floorf(std::min(command.u0, u1)));
+      command.uMax = std::min(texels->width, (int)ceilf(std::max(command.u0, u1))) - 1;
+      command.vMin = std::max(0, (int)floorf(std::min(command.v0, v1)));
+      command.vMax = std::min(texels->height, (int)ceilf(std::max(command.v0, v1))) - 1;
+      if (command.uMin > command.uMax || command.vMin > command.vMax)
+      {
+        return *this;
+      }
+    }
+
+    // Bounds of the corners: world = dest + R(rotation) (local - origin)
+    float left = INFINITY, right = -INFINITY, top = INFINITY, bottom = -INFINITY;
+    for (::Vector2 corner : {::Vector2{0, 0}, ::Vector2{dest.width, 0}, ::Vector2{0, dest.height},
+                             ::Vector2{dest.width, dest.height}})
+    {
+      float x = corner.x - origin.x;
+      float y = corner.y - origin.y;
+      float worldX = dest.x + x * command.cosine - y * command.sine;
+      float worldY = dest.y + x * command.sine + y * command.cosine;
+      left = std::min(left, worldX);
+      right = std::max(right, worldX);
+      top = std::min(top, worldY);
+      bottom = std::max(bottom, worldY);
+    }
+    Push(command, left, top, right, bottom);
+    return *this;
+  }
+
+  void Bin()
+  {
+    int columns = (target.width + TILE - 1) / TILE;
+    int rows = (target.height + TILE - 1) / TILE;
+    bins.resize((size_t)columns * rows);
+    for (std::vector<int> &bin : bins)
+    {
+      bin.clear();
+    }
+    for (int i = 0; i < (int)commands.size(); ++i)
+    {
+      const Command &command = commands[i];
+      for (int row = command.top / TILE; row <= (command.bottom - 1) / TILE; ++row)
+      {
+        for (int column = command.left / TILE; column <= (command.right - 1) / TILE; ++column)
+        {
+          bins[(size_t)row * columns + column].push_back(i);
+        }
+      }
+    }
+  }
+
+  // Tiles band, band + bands, ... so each band gets some of every part of the frame
+  void RenderTiles(int band, int bands)
+  {
+    int columns = (target.width + TILE - 1) / TILE;
+    ::Color scratch[TILE];
+    for (int tile = band; tile < (int)bins.size(); tile += bands)
+    {
+      int left = tile % columns * TILE;
+      int top = tile / columns * TILE;
+      for (int i : bins[tile])
+      {
+        const Command &command = commands[i];
+        Rasterize(command, std::max(left, command.left), std::max(top, command.top),
+                  std::min(left + TILE, command.right), std::min(top + TILE, command.bottom), scratch);
+      }
+    }
+  }
+
+  inline ::Color *Row(int y)
+  {
+    return (::Color *)target.data + (size_t)y * target.width;
+  }
+
+  static ::Color Lerp(::Color a, ::Color b, float t)
+  {
+    t = t < 0.0f ? 0.0f : t > 1.0f ? 1.0f : t;
+    return ::Color{(unsigned char)(a.r + (b.r - a.r) * t + 0.5f), (unsigned char)(a.g + (b.g - a.g) * t + 0.5f),
+                   (unsigned char)(a.b + (b.b - a.b) * t + 0.5f), (unsigned char)(a.a + (b.a - a.a) * t + 0.5f)};
+  }
+
+  // Blend color over count pixels, a plain store when it is opaque
+  static void FillSpan(::Color *pixels, int count, ::Color color, ::Color *scratch)
+  {
+    if (color.a == 255)
+    {
+      std::fill_n(pixels, count, color);
+      return;
+    }
+    std::fill_n(scratch, count, color);
+    ColorBatch::AlphaBlend(pixels, scratch, pixels, count);
+  }
+
+  // Narrow [*low, *high) to the t where 0 <= start + step * t < size
+  static void Clip(float start, float step, float size, float *low, float *high)
+  {
+    if (step == 0.0f)
+    {
+      if (start < 0.0f || start >= size)
+      {
+        *high = *low;
+      }
+      return;
+    }
+    float enter = -start / step;
+    float leave = (size - start) / step;
+    if (step < 0.0f)
+    {
+      std::swap(enter, leave);
+    }
+    *low = std::max(*low, enter);
+    *high = std::min(*high, leave);
+  }
+
+  // Draw command over pixels [x0, x1) x [y0, y1), all inside one tile
+  void Rasterize(const Command &command, int x0, int y0, int x1, int y1, ::Color *scratch)
+  {
+    if (x0 >= x1 || y0 >= y1)
+    {
+      return;
+    }
+    int count = x1 - x0;
+    switch (command.kind)
+    {
+    case CLEAR:
+      for (int y = y0; y < y1; ++y)
+      {
+        std::fill_n(Row(y) + x0, count, command.color);
+      }
+      break;
+    case FILL:
+      for (int y = y0; y < y1; ++y)
+      {
+        FillSpan(Row(y) + x0, count, command.color, scratch);
+      }
+      break;
+    case GRADIENT_V:
+      for (int y = y0; y < y1; ++y)
+      {
+        FillSpan(Row(y) + x0, count, Lerp(command.color, command.color2, (y + 0.5f - command.y) / command.height),
+                 scratch);
+      }
+      break;
+    case GRADIENT_H:
+      for (int x = x0; x < x1; ++x)
+      {
+        scratch[x - x0] = Lerp(command.color, command.color2, (x + 0.5f - command.x) / command.width);
+      }
+      for (int y = y0; y < y1; ++y)
+      {
+        ColorBatch::AlphaBlend(Row(y) + x0, scratch, Row(y) + x0, count);
+      }
+      break;
+    case CIRCLE:
+      for (int y = y0; y < y1; ++y)
+      {
+        float dy = y + 0.5f - command.y;
+        float reach = command.width * command.width - dy * dy;
+        if (reach < 0.0f)
+        {
+          continue;
+        }
+        reach = sqrtf(reach);
+        int start = std::max(x0, (int)ceilf(command.x - reach - 0.5f));
+        int end = std::min(x1, (int)ceilf(command.x + reach - 0.5f));
+        if (start >= end)
+        {
+          continue;
+        }
+        if (std::memcmp(&command.color, &command.color2, sizeof(::Color)) == 0)
+        {
+          FillSpan(Row(y) + start, end - start, command.color, scratch);
+          continue;
+        }
+        for (int x = start; x < end; ++x)
+        {
+          float dx = x + 0.5f - command.x;
+          scratch[x - start] = Lerp(command.color, command.color2, sqrtf(dx * dx + dy * dy) / command.width);
+        }
+        ColorBatch::AlphaBlend(Row(y) + start, scratch, Row(y) + start, end - start);
+      }
+      break;
+    case QUAD:
+      RasterizeQuad(command, x0, y0, x1, y1, scratch);
+      break;
+    }
+  }
+
+  void RasterizeQuad(const Command &command, int x0, int y0, int x1, int y1, ::Color *scratch)
+  {
+    bool white = command.color.r == 255 && command.color.g == 255 && command.color.b == 255 && command.color.a == 255;
+    for (int y = y0; y < y1; ++y)
+    {
+      // Local position of the pixel centered at t = x + 0.5 on this row is (localX + cosine t, localY - sine t)
+      float dy = y + 0.5f - command.y;
+      float localX = command.sine * dy - command.cosine * command.x + command.originX;
+      float localY = command.cosine * dy + command.sine * command.x + command.originY;
+      float low = x0 + 0.5f;
+      float high = x1 + 0.5f;
+      Clip(localX, command.cosine, command.width, &low, &high);
+      Clip(localY, -command.sine, command.height, &low, &high);
+      if (low >= high)
+      {
+        continue;
+      }
+      int start = std::max(x0, (int)ceilf(low - 0.5f));
+      int end = std::min(x1, (int)ceilf(high - 0.5f));
+      if (start >= end)
+      {
+        continue;
+      }
+      ::Color *pixels = Row(y) + start;
+      if (command.texels == nullptr)
+      {
+        FillSpan(pixels, end - start, command.color, scratch);
+        continue;
+      }
+
+      const ::Color *texels = (const ::Color *)command.texels->data;
+      int stride = command.texels->width;
+      for (int x = start; x < end; ++x)
+      {
+        float t = x + 0.5f;
+        int u = (int)floorf(command.u0 + (localX + command.cosine * t) * command.du);
+        int v = (int)floorf(command.v0 + (localY - command.sine * t) * command.dv);
+        u = u < command.uMin ? command.uMin : u > command.uMax ? command.uMax : u;
+        v = v < command.vMin ? command.vMin : v > command.vMax ? command.vMax : v;
+        scratch[x - start] = texels[(size_t)v * stride + u];
+      }
+      if (!white)
+      {
+        ColorBatch::Tint(scratch, command.color, scratch, end - start);
+      }
+      ColorBatch::AlphaBlend(pixels, scratch, pixels, end - start);
+    }
+  }
+};
+} // namespace raylib
+
+#endif
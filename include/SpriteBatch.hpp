@@ -0,0 +1,358 @@
+#ifndef RAYLIB_CPP_SPRITEBATCH_HPP_
+#define RAYLIB_CPP_SPRITEBATCH_HPP_
+
+#include <cmath>
+#include <vector>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+#include "raylib.h"
+#include "rlgl.h"
+#ifdef __cplusplus
+}
+#endif
+
+#include "./raylib-cpp-utils.hpp"
+
+namespace raylib
+{
+/**
+ * Collects textured quads on the CPU and draws all the quads of one texture in a single submission.
+ *
+ * Quads are grouped by texture in the order each texture first appears in the batch, and quads on the same texture
+ * keep the order they were added in. Every texture is therefore drawn as one layer: flush the batch in between if a
+ * texture has to go both under and over another one, or before drawing anything that is not in the batch.
+ *
+ * Grouping and sorting never touch the GPU, so Build() and Flush() with a custom submit function work headless.
+ */
+class SpriteBatch
+{
+public:
+  /**
+   * One textured quad, with the same meaning as the arguments of ::DrawTexturePro().
+   */
+  struct Quad
+  {
+    ::Texture2D texture;
+    ::Rectangle source;
+    ::Rectangle dest;
+    ::Vector2 origin;
+    float rotation;
+    ::Color tint;
+  };
+
+  /**
+   * The quads of one texture after Build(), a range of Sorted().
+   */
+  struct Run
+  {
+    ::Texture2D texture;
+    int first;
+    int count;
+  };
+
+  /**
+   * Counters over all the flushes since construction or the last ResetStats().
+   */
+  struct Stats
+  {
+    long long flushes = 0;
+    long long submissions = 0; // one per texture per flush
+    long long quads = 0;
+    int lastSubmissions = 0;
+    int lastQuads = 0;
+
+    inline float QuadsPerFlush() const
+    {
+      return flushes > 0 ? (float)quads / flushes : 0.0f;
+    }
+
+    inline float QuadsPerSubmission() const
+    {
+      return submissions > 0 ? (float)quads / submissions : 0.0f;
+    }
+  };
+
+  /**
+   * Create a batch with room for a number of quads before it has to grow.
+   */
+  SpriteBatch(int capacity = 1024)
+  {
+    quads.reserve(capacity);
+    sorted.reserve(capacity);
+  }
+
+  inline int Count() const
+  {
+    return (int)quads.size();
+  }
+
+  inline bool Empty() const
+  {
+    return quads.empty();
+  }
+
+  inline const Stats &GetStats() const
+  {
+    return stats;
+  }
+
+  inline void ResetStats()
+  {
+    stats = Stats{};
+  }
+
+  /**
+   * Drop the pending quads without drawing them.
+   */
+  inline SpriteBatch &Clear()
+  {
+    quads.clear();
+    return *this;
+  }
+
+  inline SpriteBatch &Add(const Quad &quad)
+  {
+    quads.push_back(quad);
+    return *this;
+  }
+
+  /**
+   * Add a quad, as ::DrawTexturePro() would draw it.
+   */
+  inline SpriteBatch &Add(const ::Texture2D &texture, ::Rectangle sourceRec, ::Rectangle destRec, ::Vector2 origin,
+                          float rotation = 0, ::Color tint = WHITE)
+  {
+    quads.push_back(Quad{texture, sourceRec, destRec, origin, rotation, tint});
+    return *this;
+  }
+
+  /**
+   * Add a quad, as ::DrawTextureRec() would draw it.
+   */
+  inline SpriteBatch &Add(const ::Texture2D &texture, ::Rectangle sourceRec, ::Vector2 position, ::Color tint = WHITE)
+  {
+    return Add(texture, sourceRec, ::Rectangle{position.x, position.y, fabsf(sourceRec.width), fabsf(sourceRec.height)},
+               ::Vector2{0, 0}, 0, tint);
+  }
+
+  /**
+   * Add a quad, as ::DrawTextureEx() would draw it.
+   */
+  inline SpriteBatch &Add(const ::Texture2D &texture, ::Vector2 position, float rotation, float scale = 1.0f,
+                          ::Color tint = WHITE)
+  {
+    return Add(texture, ::Rectangle{0, 0, (float)texture.width, (float)texture.height}, position, rotation, scale,
+               tint);
+  }
+
+  /**
+   * Add a quad, as ::DrawTextureEx() would draw it if the texture were only sourceRec, e.g. a sprite in an atlas.
+   */
+  inline SpriteBatch &Add(const ::Texture2D &texture, ::Rectangle sourceRec, ::Vector2 position, float rotation,
+                          float scale = 1.0f, ::Color tint = WHITE)
+  {
+    return Add(texture, sourceRec,
+               ::Rectangle{position.x, position.y, fabsf(sourceRec.width) * scale, fabsf(sourceRec.height) * scale},
+               ::Vector2{0, 0}, rotation, tint);
+  }
+
+  /**
+   * Add a quad, as ::DrawTextureV() would draw it.
+   */
+  inline SpriteBatch &Add(const ::Texture2D &texture, ::Vector2 position, ::Color tint = WHITE)
+  {
+    return Add(texture, position, 0, 1.0f, tint);
+  }
+
+  /**
+   * Group the pending quads by texture, see Sorted() and Runs(). Takes one pass to find the texture of each quad and
+   * one to move it into place, the pending quads are left as they are.
+   */
+  const std::vector<Run> &Build()
+  {
+    runs.clear();
+    runOf.resize(quads.size());
+
+    int last = -1;
+    for (size_t i = 0; i < quads.size(); ++i)
+    {
+      unsigned int id = quads[i].texture.id;
+      if (last < 0 || runs[last].texture.id != id)
+      {
+        last = FindRun(id);
+        if (last < 0)
+        {
+          last = (int)runs.size();
+          runs.push_back(Run{quads[i].texture, 0, 0});
+        }
+      }
+      runs[last].count++;
+      runOf[i] = last;
+    }
+
+    int first = 0;
+    for (Run &run : runs)
+    {
+      run.first = first;
+      first += run.count;
+    }
+
+    next.resize(runs.size());
+    for (size_t r = 0; r < runs.size(); ++r)
+    {
+      next[r] = runs[r].first;
+    }
+    sorted.resize(quads.size());
+    for (size_t i = 0; i < quads.size(); ++i)
+    {
+      sorted[next[runOf[i]]++] = quads[i];
+    }
+    return runs;
+  }
+
+  /**
+   * Quads grouped by texture by the last Build().
+   */
+  inline const std::vector<Quad> &Sorted() const
+  {
+    return sorted;
+  }
+
+  /**
+   * Texture ranges of Sorted() found by the last Build().
+   */
+  inline const std::vector<Run> &Runs() const
+  {
+    return runs;
+  }
+
+  /**
+   * Build the batch and hand every texture's quads to submit(texture, quads, count) in one call, then empty it.
+   */
+  template <typename Submit> SpriteBatch &Flush(Submit submit)
+  {
+    if (quads.empty())
+    {
+      return *this;
+    }
+
+    Build();
+    for (const Run &run : runs)
+    {
+      submit(run.texture, sorted.data() + run.first, run.count);
+    }
+
+    stats.flushes++;
+    stats.submissions += (long long)runs.size();
+    stats.quads += (long long)quads.size();
+    stats.lastSubmissions = (int)runs.size();
+    stats.lastQuads = (int)quads.size();
+    quads.clear();
+    return *this;
+  }
+
+  /**
+   * Draw the batch through rlgl, one texture bind and one quad list per texture, then empty it.
+   */
+  inline SpriteBatch &Flush()
+  {
+    return Flush(SubmitQuads);
+  }
+
+  /**
+   * Draw quads of one texture as a single quad list, like ::DrawTexturePro() with the transform done on the CPU.
+   */
+  static void SubmitQuads(const ::Texture2D &texture, const Quad *quads, int count)
+  {
+    if (texture.id == 0)
+    {
+      return;
+    }
+
+    float width = (float)texture.width;
+    float height = (float)texture.height;
+
+    for (int done = 0; done < count; done += SUBMIT_CHUNK)
+    {
+      int chunk = count - done < SUBMIT_CHUNK ? count - done : SUBMIT_CHUNK;
+      if (::rlCheckBufferLimit(4 * chunk))
+      {
+        ::rlglDraw();
+      }
+
+      ::rlEnableTexture(texture.id);
+      ::rlBegin(RL_QUADS);
+      ::rlNormal3f(0.0f, 0.0f, 1.0f);
+      for (int i = done; i < done + chunk; ++i)
+      {
+        const Quad &quad = quads[i];
+        ::Rectangle source = quad.source;
+        bool flipX = false;
+        if (source.width < 0)
+        {
+          flipX = true;
+          source.width *= -1;
+        }
+        if (source.height < 0)
+        {
+          source.y -= source.height;
+        }
+
+        float left = (flipX ? source.x + source.width : source.x) / width;
+        float right = (flipX ? source.x : source.x + source.width) / width;
+        float top = source.y / height;
+        float bottom = (source.y + source.height) / height;
+
+        float sine = sinf(quad.rotation * DEG2RAD);
+        float cosine = cosf(quad.rotation * DEG2RAD);
+        auto vertex = [&](float x, float y) {
+          x -= quad.origin.x;
+          y -= quad.origin.y;
+          ::rlVertex2f(quad.dest.x + x * cosine - y * sine, quad.dest.y + x * sine + y * cosine);
+        };
+
+        ::rlColor4ub(quad.tint.r, quad.tint.g, quad.tint.b, quad.tint.a);
+        ::rlTexCoord2f(left, top);
+        vertex(0.0f, 0.0f);
+        ::rlTexCoord2f(left, bottom);
+        vertex(0.0f, quad.dest.height);
+        ::rlTexCoord2f(right, bottom);
+        vertex(quad.dest.width, quad.dest.height);
+        ::rlTexCoord2f(right, top);
+        vertex(quad.dest.width, 0.0f);
+      }
+      ::rlEnd();
+      ::rlDisableTexture();
+    }
+  }
+
+private:
+  // Quads per quad list, well under what rlgl's default vertex buffer holds
+  static const int SUBMIT_CHUNK = 1024;
+
+  std::vector<Quad> quads;
+  std::vector<Quad> sorted;
+  std::vector<Run> runs;
+  std::vector<int> runOf;
+  std::vector<int> next;
+  Stats stats;
+
+  // A batch rarely holds more than a handful of textures, so a linear search beats hashing here
+  int FindRun(unsigned int id) const
+  {
+    for (size_t r = 0; r < runs.size(); ++r)
+    {
+      if (runs[r].texture.id == id)
+      {
+        return (int)r;
+      }
+    }
+    return -1;
+  }
+};
+} // namespace raylib
+
+#endif
@@ -12,6 +12,7 @@ extern "C"
 }
 #endif
 
+#include "./MappedImage.hpp"
 #include "./Material.hpp"
 #include "./Vector2.hpp"
 #include "./raylib-cpp-utils.hpp"
@@ -78,8 +79,17 @@ public:
     set(::LoadTextureCubemap(image, layoutType));
   }
 
+  /**
+   * Load a texture file. A .rawimg file is uploaded straight from its mapping, with no decoding and no copy.
+   */
   void Load(const std::string &fileName)
   {
+    if (MappedImage::IsRawFile(fileName))
+    {
+      MappedImage image{fileName};
+      set(image.IsReady() ? ::LoadTextureFromImage(image.GetImage()) : ::Texture2D{});
+      return;
+    }
     set(::LoadTexture(fileName.c_str()));
   }
 
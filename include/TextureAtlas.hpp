@@ -0,0 +1,391 @@
+#ifndef RAYLIB_CPP_TEXTUREATLAS_HPP_
+#define RAYLIB_CPP_TEXTUREATLAS_HPP_
+
+#include <algorithm>
+#include <cstdio>
+#include <future>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+#include "raylib.h"
+#ifdef __cplusplus
+}
+#endif
+
+#include "./Image.hpp"
+#include "./ImageLoader.hpp"
+#include "./raylib-cpp-utils.hpp"
+
+namespace raylib
+{
+/**
+ * Places rectangles on a strip of fixed width with the skyline bottom-left rule.
+ *
+ * The skyline is the top edge of everything placed so far, a list of horizontal segments. A rectangle goes where its
+ * bottom would sit lowest on the skyline, leftmost on ties, and the segments it covers are replaced by its top edge.
+ * The strip grows downwards as needed, so every rectangle no wider than the strip fits. Placement never touches
+ * the GPU or any image.
+ */
+class AtlasPacker
+{
+public:
+  /**
+   * Start an empty strip, keeping padding pixels free to the right of and below every rectangle.
+   */
+  AtlasPacker(int width, int padding = 0) : width{width}, padding{padding}
+  {
+    skyline.push_back(Segment{0, 0, width});
+  }
+
+  inline int Width() const
+  {
+    return width;
+  }
+
+  /**
+   * Height of the strip used so far, padding of the lowest rectangles included.
+   */
+  inline int Height() const
+  {
+    return height;
+  }
+
+  /**
+   * Place a rectangle, false if it is wider than the strip.
+   */
+  bool Insert(int rectWidth, int rectHeight, ::Rectangle *placed)
+  {
+    int bestIndex = -1, bestY = 0, bestWidth = 0;
+    for (size_t i = 0; i < skyline.size() && skyline[i].x + rectWidth <= width; ++i)
+    {
+      // The last rectangle on a row may lose its right padding to the edge of the strip
+      int coverWidth = std::min(rectWidth + padding, width - skyline[i].x);
+      int y = Top(i, coverWidth);
+      if (bestIndex < 0 || y < bestY)
+      {
+        bestIndex = (int)i;
+        bestY = y;
+        bestWidth = coverWidth;
+      }
+    }
+    if (bestIndex < 0)
+    {
+      return false;
+    }
+
+    int x = skyline[bestIndex].x;
+    AddSegment(bestIndex, Segment{x, bestY + rectHeight + padding, bestWidth});
+    height = std::max(height, bestY + rectHeight + padding);
+    *placed = ::Rectangle{(float)x, (float)bestY, (float)rectWidth, (float)rectHeight};
+    return true;
+  }
+
+  /**
+   * Place all the sizes, tallest first, on the narrowest power-of-two strip that holds the widest of them and keeps
+   * the atlas roughly square. Returns the placements in the order of the sizes.
+   */
+  static std::vector<::Rectangle> Pack(const std::vector<::Vector2> &sizes, int padding, int *atlasWidth,
+                                       int *atlasHeight)
+  {
+    long long area = 0;
+    int widest = 1;
+    for (const ::Vector2 &size : sizes)
+    {
+      area += (long long)(size.x + padding) * (long long)(size.y + padding);
+      widest = std::max(widest, (int)size.x);
+    }
+    int stripWidth = 1;
+    while (stripWidth < widest || (long long)stripWidth * stripWidth < area)
+    {
+      stripWidth *= 2;
+    }
+
+    std::vector<int> order(sizes.size());
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+      order[i] = (int)i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&sizes](int a, int b) {
+      return sizes[a].y > sizes[b].y || (sizes[a].y == sizes[b].y && sizes[a].x > sizes[b].x);
+    });
+
+    AtlasPacker packer{stripWidth, padding};
+    std::vector<::Rectangle> placed(sizes.size());
+    for (int i : order)
+    {
+      if (sizes[i].x > 0 && sizes[i].y > 0)
+      {
+        packer.Insert((int)sizes[i].x, (int)sizes[i].y, &placed[i]);
+      }
+    }
+    *atlasWidth = stripWidth;
+    *atlasHeight = std::max(1, packer.Height());
+    return placed;
+  }
+
+private:
+  struct Segment
+  {
+    int x;
+    int y;
+    int width;
+  };
+
+  int width;
+  int padding;
+  int height = 0;
+  std::vector<Segment> skyline;
+
+  // Highest point of the skyline under coverWidth pixels starting at segment index
+  int Top(size_t index, int coverWidth) const
+  {
+    int top = 0;
+    int right = skyline[index].x + coverWidth;
+    for (size_t i = index; i < skyline.size() && skyline[i].x < right; ++i)
+    {
+      top = std::max(top, skyline[i].y);
+    }
+    return top;
+  }
+
+  // Put segment at index, trimming or dropping the segments it covers and merging neighbours at the same height
+  void AddSegment(int index, Segment segment)
+  {
+    skyline.insert(skyline.begin() + index, segment);
+    int right = segment.x + segment.width;
+    for (size_t i = index + 1; i < skyline.size();)
+    {
+      if (skyline[i].x >= right)
+      {
+        break;
+      }
+      int shrink = right - skyline[i].x;
+      if (shrink >= skyline[i].width)
+      {
+        skyline.erase(skyline.begin() + i);
+        continue;
+      }
+      skyline[i].x += shrink;
+      skyline[i].width -= shrink;
+      break;
+    }
+    for (size_t i = 0; i + 1 < skyline.size();)
+    {
+      if (skyline[i].y == skyline[i + 1].y)
+      {
+        skyline[i].width += skyline[i + 1].width;
+        skyline.erase(skyline.begin() + i + 1);
+      }
+      else
+      {
+        ++i;
+      }
+    }
+  }
+};
+
+/**
+ * One image holding many sprites, plus the rectangle of every sprite by name.
+ *
+ * Pack() composes the atlas at runtime from image files with Image::Draw(), Export() writes it out as an image and a
+ * text table of "name x y width height" lines, and Load() reads such a pair back. Upload GetImage() to a single
+ * Texture2D and draw every sprite from its source rectangle.
+ */
+class TextureAtlas
+{
+public:
+  TextureAtlas() = default;
+
+  ~TextureAtlas()
+  {
+    Unload();
+  }
+
+  TextureAtlas(const TextureAtlas &) = delete;
+  TextureAtlas &operator=(const TextureAtlas &) = delete;
+
+  /**
+   * Pack named images into a new atlas, padding pixels apart. Images that failed to load are left out.
+   */
+  bool Pack(const std::vector<std::pair<std::string, ::Image>> &images, int padding = 2)
+  {
+    Unload();
+
+    std::vector<::Vector2> sizes;
+    for (const auto &named : images)
+    {
+      sizes.push_back(::Vector2{(float)named.second.width, (float)named.second.height});
+      if (named.second.data == nullptr)
+      {
+        sizes.back() = ::Vector2{0, 0};
+      }
+    }
+
+    int atlasWidth, atlasHeight;
+    std::vector<::Rectangle> placed = AtlasPacker::Pack(sizes, padding, &atlasWidth, &atlasHeight);
+    image.set(::GenImageColor(atlasWidth, atlasHeight, BLANK));
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+      if (images[i].second.data == nullptr)
+      {
+        continue;
+      }
+      ::Image source = images[i].second;
+      image.Draw(source, ::Rectangle{0, 0, (float)source.width, (float)source.height}, placed[i]);
+      table[images[i].first] = placed[i];
+    }
+    return table.size() == images.size();
+  }
+
+  /**
+   * Load and pack name, file name pairs. False if any file could not be loaded, the rest are packed regardless.
+   */
+  bool Pack(const std::vector<std::pair<std::string, std::string>> &files, int padding = 2)
+  {
+    std::vector<std::pair<std::string, ::Image>> images;
+    for (const auto &file : files)
+    {
+      images.emplace_back(file.first, ::LoadImage(file.second.c_str()));
+    }
+    return PackAndUnload(images, padding);
+  }
+
+  /**
+   * Like Pack(files, padding), but with the files decoded in parallel by loader.
+   */
+  bool Pack(const std::vector<std::pair<std::string, std::string>> &files, ImageLoader &loader, int padding = 2)
+  {
+    std::vector<std::future<::Image>> decoding;
+    for (const auto &file : files)
+    {
+      decoding.push_back(loader.Load(file.second));
+    }
+    std::vector<std::pair<std::string, ::Image>> images;
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+      images.emplace_back(files[i].first, decoding[i].get());
+    }
+    return PackAndUnload(images, padding);
+  }
+
+  /**
+   * Read an atlas written by Export().
+   */
+  bool Load(const std::string &imageFile, const std::string &tableFile)
+  {
+    Unload();
+
+    FILE *file = std::fopen(tableFile.c_str(), "r");
+    if (file == nullptr)
+    {
+      return false;
+    }
+    char name[256];
+    ::Rectangle rect;
+    while (std::fscanf(file, "%255s %f %f %f %f", name, &rect.x, &rect.y, &rect.width, &rect.height) == 5)
+    {
+      table[name] = rect;
+    }
+    bool read = std::feof(file) != 0;
+    std::fclose(file);
+
+    image.Load(imageFile);
+    return read && image.data != nullptr;
+  }
+
+  /**
+   * Write the atlas image and its table, names must not contain whitespace.
+   */
+  bool Export(const std::string &imageFile, const std::string &tableFile)
+  {
+    FILE *file = std::fopen(tableFile.c_str(), "w");
+    if (file == nullptr)
+    {
+      return false;
+    }
+    for (const auto &entry : table)
+    {
+      const ::Rectangle &rect = entry.second;
+      std::fprintf(file, "%s %d %d %d %d\n", entry.first.c_str(), (int)rect.x, (int)rect.y, (int)rect.width,
+                   (int)rect.height);
+    }
+    bool written = std::fclose(file) == 0;
+
+    image.Export(imageFile);
+    return written;
+  }
+
+  inline void Unload()
+  {
+    if (image.data != nullptr)
+    {
+      image.Unload();
+    }
+    image.set(::Image{nullptr, 0, 0, 0, 0});
+    table.clear();
+  }
+
+  inline bool Has(const std::string &name) const
+  {
+    return table.count(name) > 0;
+  }
+
+  /**
+   * Rectangle of a sprite in the atlas, empty if there is no such sprite.
+   */
+  inline ::Rectangle Get(const std::string &name) const
+  {
+    auto found = table.find(name);
+    return found != table.end() ? found->second : ::Rectangle{0, 0, 0, 0};
+  }
+
+  /**
+   * Rectangle of a part of a sprite in the atlas, part being relative to the sprite's own image.
+   */
+  inline ::Rectangle Get(const std::string &name, ::Rectangle part) const
+  {
+    ::Rectangle sprite = Get(name);
+    return ::Rectangle{sprite.x + part.x, sprite.y + part.y, part.width, part.height};
+  }
+
+  /**
+   * Copy one sprite back out of the atlas.
+   */
+  inline Image Extract(const std::string &name)
+  {
+    return image.FromImage(Get(name));
+  }
+
+  inline Image &GetImage()
+  {
+    return image;
+  }
+
+  inline const std::map<std::string, ::Rectangle> &GetTable() const
+  {
+    return table;
+  }
+
+private:
+  Image image{::Image{nullptr, 0, 0, 0, 0}};
+  std::map<std::string, ::Rectangle> table;
+
+  bool PackAndUnload(std::vector<std::pair<std::string, ::Image>> &images, int padding)
+  {
+    bool packed = Pack(images, padding);
+    for (auto &named : images)
+    {
+      ::UnloadImage(named.second);
+    }
+    return packed;
+  }
+};
+} // namespace raylib
+
+#endif
@@ -0,0 +1,153 @@
+#ifndef RAYLIB_CPP_THREADPOOL_HPP_
+#define RAYLIB_CPP_THREADPOOL_HPP_
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace raylib
+{
+/**
+ * A fixed set of worker threads running queued jobs in order.
+ *
+ * ImageLoader decodes on one, and the Image overloads taking a ThreadPool split their pixels across one.
+ */
+class ThreadPool
+{
+public:
+  /**
+   * Start the workers, one per hardware thread by default.
+   */
+  ThreadPool(int workers = 0)
+  {
+    if (workers <= 0)
+    {
+      workers = std::max(1, (int)std::thread::hardware_concurrency());
+    }
+    for (int i = 0; i < workers; ++i)
+    {
+      threads.emplace_back([this]() { Work(); });
+    }
+  }
+
+  /**
+   * Finish the queued jobs, then stop the workers.
+   */
+  ~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock{mutex};
+      stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread &thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  inline int Workers() const
+  {
+    return (int)threads.size();
+  }
+
+  /**
+   * Queue a job, the future yields what it returns or rethrows what it throws.
+   */
+  template <typename Job> std::future<decltype(std::declval<Job &>()())> Submit(Job job)
+  {
+    using Result = decltype(job());
+    auto task = std::make_shared<std::packaged_task<Result()>>(std::move(job));
+    std::future<Result> result = task->get_future();
+    {
+      std::lock_guard<std::mutex> lock{mutex};
+      jobs.push_back([task]() { (*task)(); });
+    }
+    wake.notify_one();
+    return result;
+  }
+
+  /**
+   * Call job(0) to job(count - 1), job(0) on the calling thread and the rest on the workers, and return once all of
+   * them did. Rethrows the first exception a call threw. Calling it from a job of the same pool can deadlock.
+   */
+  template <typename Job> void ParallelFor(int count, const Job &job)
+  {
+    std::vector<std::future<void>> calls;
+    for (int i = 1; i < count; ++i)
+    {
+      calls.push_back(Submit([&job, i]() { job(i); }));
+    }
+
+    std::exception_ptr failure;
+    if (count > 0)
+    {
+      try
+      {
+        job(0);
+      }
+      catch (...)
+      {
+        failure = std::current_exception();
+      }
+    }
+    // Every call has to be finished before job goes out of scope, even after a failure
+    for (std::future<void> &call : calls)
+    {
+      try
+      {
+        call.get();
+      }
+      catch (...)
+      {
+        if (!failure)
+        {
+          failure = std::current_exception();
+        }
+      }
+    }
+    if (failure)
+    {
+      std::rethrow_exception(failure);
+    }
+  }
+
+private:
+  std::vector<std::thread> threads;
+  std::deque<std::function<void()>> jobs;
+  std::mutex mutex;
+  std::condition_variable wake;
+  bool stopping = false;
+
+  void Work()
+  {
+    for (;;)
+    {
+      std::function<void()> job;
+      {
+        std::unique_lock<std::mutex> lock{mutex};
+        wake.wait(lock, [this]() { return stopping || !jobs.empty(); });
+        if (jobs.empty())
+        {
+          return;
+        }
+        job = std::move(jobs.front());
+        jobs.pop_front();
+      }
+      job();
+    }
+  }
+};
+} // namespace raylib
+
+#endif
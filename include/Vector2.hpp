@@ -21,19 +21,17 @@ extern "C"
 
 namespace raylib
 {
+/**
+ * Vector2 type. Trivially copyable, and the arithmetic is constexpr, so vectors can be game constants.
+ */
 class Vector2 : public ::Vector2
 {
 public:
-  Vector2(::Vector2 vec)
-  {
-    set(vec);
-  };
-  Vector2(float X = 0, float Y = 0)
-  {
-    x = X;
-    y = Y;
-  };
-  inline void set(::Vector2 vec)
+  constexpr Vector2(const ::Vector2 &vec) : ::Vector2{vec.x, vec.y} {}
+
+  constexpr Vector2(float X = 0, float Y = 0) : ::Vector2{X, Y} {}
+
+  constexpr void set(const ::Vector2 &vec)
   {
     x = vec.x;
     y = vec.y;
@@ -42,186 +40,166 @@ public:
   GETTERSETTER(float, X, x)
   GETTERSETTER(float, Y, y)
 
-  Vector2 &operator=(const ::Vector2 &vector2)
+  constexpr Vector2 &operator=(const ::Vector2 &vector2)
   {
     set(vector2);
     return *this;
   }
 
-  Vector2 &operator=(const Vector2 &vector2)
+  constexpr bool operator==(const ::Vector2 &other) const
   {
-    set(vector2);
-    return *this;
+    return x == other.x && y == other.y;
   }
 
-  bool operator==(const Vector2 &other)
+  constexpr bool operator!=(const ::Vector2 &other) const
   {
-    return x == other.x && y == other.y;
+    return !(*this == other);
   }
 
 #ifndef RAYLIB_CPP_NO_MATH
-  Vector2 Add(const Vector2 &vector2)
+  constexpr Vector2 Add(const ::Vector2 &vector2) const
   {
-    return Vector2Add(*this, vector2);
+    return Vector2{x + vector2.x, y + vector2.y};
   }
 
-  Vector2 operator+(const Vector2 &vector2)
+  constexpr Vector2 operator+(const ::Vector2 &vector2) const
   {
-    return Vector2Add(*this, vector2);
+    return Add(vector2);
   }
 
-  Vector2 Subtract(const Vector2 &vector2)
+  constexpr Vector2 Subtract(const ::Vector2 &vector2) const
   {
-    return Vector2Subtract(*this, vector2);
+    return Vector2{x - vector2.x, y - vector2.y};
   }
 
-  Vector2 operator-(const Vector2 &vector2)
+  constexpr Vector2 operator-(const ::Vector2 &vector2) const
   {
-    return Vector2Subtract(*this, vector2);
+    return Subtract(vector2);
   }
 
-  Vector2 Negate()
+  constexpr Vector2 Negate() const
   {
-    return Vector2Negate(*this);
+    return Vector2{-x, -y};
   }
 
-  Vector2 operator-()
+  constexpr Vector2 operator-() const
   {
-    return Vector2Negate(*this);
+    return Negate();
   }
 
-  Vector2 Multiply(const Vector2 &vector2)
+  constexpr Vector2 Multiply(const ::Vector2 &vector2) const
   {
-    return Vector2Multiply(*this, vector2);
+    return Vector2{x * vector2.x, y * vector2.y};
   }
 
-  Vector2 operator*(const Vector2 &vector2)
+  constexpr Vector2 operator*(const ::Vector2 &vector2) const
   {
-    return Vector2Multiply(*this, vector2);
+    return Multiply(vector2);
   }
 
-  Vector2 Scale(const float scale)
+  constexpr Vector2 Scale(const float scale) const
   {
-    return Vector2Scale(*this, scale);
+    return Vector2{x * scale, y * scale};
   }
 
-  Vector2 operator*(const float scale)
+  constexpr Vector2 operator*(const float scale) const
   {
-    return Vector2Scale(*this, scale);
+    return Scale(scale);
   }
 
-  Vector2 Divide(const Vector2 &vector2)
+  constexpr Vector2 Divide(const ::Vector2 &vector2) const
   {
-    return Vector2Divide(*this, vector2);
+    return Vector2{x / vector2.x, y / vector2.y};
   }
 
-  Vector2 operator/(const Vector2 &vector2)
+  constexpr Vector2 operator/(const ::Vector2 &vector2) const
   {
-    return Vector2Divide(*this, vector2);
+    return Divide(vector2);
   }
 
-  Vector2 &Divide(const float div)
+  constexpr Vector2 Divide(const float div) const
   {
-    x /= div;
-    y /= div;
-
-    return *this;
+    return Vector2{x / div, y / div};
   }
 
-  Vector2 &operator/(const float div)
+  constexpr Vector2 operator/(const float div) const
   {
-    x /= div;
-    y /= div;
-
-    return *this;
+    return Divide(div);
   }
 
-  Vector2 &operator+=(const Vector2 &vector2)
+  constexpr Vector2 &operator+=(const ::Vector2 &vector2)
   {
-    set(Vector2Add(*this, vector2));
-
-    return *this;
+    return *this = Add(vector2);
   }
 
-  Vector2 &operator-=(const Vector2 &vector2)
+  constexpr Vector2 &operator-=(const ::Vector2 &vector2)
   {
-    set(Vector2Subtract(*this, vector2));
-
-    return *this;
+    return *this = Subtract(vector2);
   }
 
-  Vector2 &operator*=(const Vector2 &vector2)
+  constexpr Vector2 &operator*=(const ::Vector2 &vector2)
   {
-    set(Vector2Multiply(*this, vector2));
-
-    return *this;
+    return *this = Multiply(vector2);
   }
 
-  Vector2 &operator*=(const float scale)
+  constexpr Vector2 &operator*=(const float scale)
   {
-    set(Vector2Scale(*this, scale));
-
-    return *this;
+    return *this = Scale(scale);
   }
 
-  Vector2 &operator/=(const Vector2 &vector2)
+  constexpr Vector2 &operator/=(const ::Vector2 &vector2)
   {
-    set(Vector2Divide(*this, vector2));
-
-    return *this;
+    return *this = Divide(vector2);
   }
 
-  Vector2 &operator/=(const float div)
+  constexpr Vector2 &operator/=(const float div)
   {
-    this->x /= div;
-    this->y /= div;
-
-    return *this;
+    return *this = Divide(div);
   }
 
-  float Length()
+  float Length() const
   {
     return Vector2Length(*this);
   }
 
-  Vector2 Normalize()
+  Vector2 Normalize() const
   {
     return Vector2Normalize(*this);
   }
 
-  float DotProduct(const Vector2 &vector2)
+  constexpr float DotProduct(const ::Vector2 &vector2) const
   {
-    return Vector2DotProduct(*this, vector2);
+    return x * vector2.x + y * vector2.y;
   }
 
-  float Angle(const Vector2 &vector2)
+  float Angle(const ::Vector2 &vector2) const
   {
     return Vector2Angle(*this, vector2);
   }
 
-  float Distance(const Vector2 &vector2)
+  float Distance(const ::Vector2 &vector2) const
   {
     return Vector2Distance(*this, vector2);
   }
 
-  Vector2 Lerp(const Vector2 &vector2, const float amount)
+  constexpr Vector2 Lerp(const ::Vector2 &vector2, const float amount) const
   {
-    return Vector2Lerp(*this, vector2, amount);
+    return Vector2{x + amount * (vector2.x - x), y + amount * (vector2.y - y)};
   }
 
-  Vector2 Rotate(float degrees)
+  Vector2 Rotate(float degrees) const
   {
     return Vector2Rotate(*this, degrees);
   }
 
-  static Vector2 Zero()
+  static constexpr Vector2 Zero()
   {
-    return Vector2Zero();
+    return Vector2{0, 0};
   }
 
-  static Vector2 One()
+  static constexpr Vector2 One()
   {
-    return Vector2One();
+    return Vector2{1, 1};
   }
 #endif
 
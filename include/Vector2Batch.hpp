@@ -0,0 +1,195 @@
+#ifndef RAYLIB_CPP_VECTOR2BATCH_HPP_
+#define RAYLIB_CPP_VECTOR2BATCH_HPP_
+
+#include <cmath>
+#include <cstddef>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+#include "raylib.h"
+#ifdef __cplusplus
+}
+#endif
+
+#include "./raylib-cpp-simd.hpp"
+
+namespace raylib
+{
+/**
+ * raymath's Vector2 operations over whole arrays of ::Vector2 (or raylib::Vector2, which has the same layout).
+ *
+ * Each kernel runs on SIMD registers (see raylib-cpp-simd.hpp) and finishes the last few elements with the scalar
+ * formula. out may be the same array as an input, the arrays may not overlap otherwise.
+ */
+namespace Vector2Batch
+{
+/**
+ * out[i] = a[i] + b[i]
+ */
+inline void Add(const ::Vector2 *a, const ::Vector2 *b, ::Vector2 *out, size_t count)
+{
+  const float *pa = &a->x;
+  const float *pb = &b->x;
+  float *po = &out->x;
+  size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+  for (; i + simd::WIDTH <= 2 * count; i += simd::WIDTH)
+  {
+    simd::Store(po + i, simd::Add(simd::Load(pa + i), simd::Load(pb + i)));
+  }
+#endif
+  for (; i < 2 * count; ++i)
+  {
+    po[i] = pa[i] + pb[i];
+  }
+}
+
+/**
+ * out[i] = a[i] + offset
+ */
+inline void Add(const ::Vector2 *a, ::Vector2 offset, ::Vector2 *out, size_t count)
+{
+  const float *pa = &a->x;
+  float *po = &out->x;
+  size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+  simd::Lane pair = simd::SetPair(offset.x, offset.y);
+  for (; i + simd::WIDTH <= 2 * count; i += simd::WIDTH)
+  {
+    simd::Store(po + i, simd::Add(simd::Load(pa + i), pair));
+  }
+#endif
+  for (; i < 2 * count; i += 2)
+  {
+    po[i] = pa[i] + offset.x;
+    po[i + 1] = pa[i + 1] + offset.y;
+  }
+}
+
+/**
+ * out[i] = a[i] * scale
+ */
+inline void Scale(const ::Vector2 *a, float scale, ::Vector2 *out, size_t count)
+{
+  const float *pa = &a->x;
+  float *po = &out->x;
+  size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+  simd::Lane factor = simd::Set(scale);
+  for (; i + simd::WIDTH <= 2 * count; i += simd::WIDTH)
+  {
+    simd::Store(po + i, simd::Mul(simd::Load(pa + i), factor));
+  }
+#endif
+  for (; i < 2 * count; ++i)
+  {
+    po[i] = pa[i] * scale;
+  }
+}
+
+/**
+ * out[i] = a[i] + amount * (b[i] - a[i]), as ::Vector2Lerp()
+ */
+inline void Lerp(const ::Vector2 *a, const ::Vector2 *b, float amount, ::Vector2 *out, size_t count)
+{
+  const float *pa = &a->x;
+  const float *pb = &b->x;
+  float *po = &out->x;
+  size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+  simd::Lane factor = simd::Set(amount);
+  for (; i + simd::WIDTH <= 2 * count; i += simd::WIDTH)
+  {
+    simd::Lane va = simd::Load(pa + i);
+    simd::Store(po + i, simd::Add(va, simd::Mul(factor, simd::Sub(simd::Load(pb + i), va))));
+  }
+#endif
+  for (; i < 2 * count; ++i)
+  {
+    po[i] = pa[i] + amount * (pb[i] - pa[i]);
+  }
+}
+
+/**
+ * out[i] = |a[i]|, as ::Vector2Length()
+ */
+inline void Length(const ::Vector2 *a, float *out, size_t count)
+{
+  const float *pa = &a->x;
+  size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+  for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+  {
+    simd::Lane x, y;
+    simd::Deinterleave(simd::Load(pa + 2 * i), simd::Load(pa + 2 * i + simd::WIDTH), &x, &y);
+    simd::Store(out + i, simd::Ordered(simd::Sqrt(simd::Add(simd::Mul(x, x), simd::Mul(y, y)))));
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    out[i] = sqrtf(a[i].x * a[i].x + a[i].y * a[i].y);
+  }
+}
+
+/**
+ * out[i] = |a[i] - point|, as ::Vector2Distance()
+ */
+inline void Distance(const ::Vector2 *a, ::Vector2 point, float *out, size_t count)
+{
+  const float *pa = &a->x;
+  size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+  simd::Lane px = simd::Set(point.x);
+  simd::Lane py = simd::Set(point.y);
+  for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+  {
+    simd::Lane x, y;
+    simd::Deinterleave(simd::Load(pa + 2 * i), simd::Load(pa + 2 * i + simd::WIDTH), &x, &y);
+    x = simd::Sub(x, px);
+    y = simd::Sub(y, py);
+    simd::Store(out + i, simd::Ordered(simd::Sqrt(simd::Add(simd::Mul(x, x), simd::Mul(y, y)))));
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    float dx = a[i].x - point.x;
+    float dy = a[i].y - point.y;
+    out[i] = sqrtf(dx * dx + dy * dy);
+  }
+}
+
+/**
+ * out[i] = a[i] / |a[i]|. Unlike ::Vector2Normalize(), a zero vector stays zero instead of turning into NaNs.
+ */
+inline void Normalize(const ::Vector2 *a, ::Vector2 *out, size_t count)
+{
+  const float *pa = &a->x;
+  float *po = &out->x;
+  size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+  for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+  {
+    simd::Lane x, y;
+    simd::Deinterleave(simd::Load(pa + 2 * i), simd::Load(pa + 2 * i + simd::WIDTH), &x, &y);
+    simd::Lane length = simd::Sqrt(simd::Add(simd::Mul(x, x), simd::Mul(y, y)));
+    x = simd::WherePositive(length, simd::Div(x, length));
+    y = simd::WherePositive(length, simd::Div(y, length));
+
+    simd::Lane lo, hi;
+    simd::Interleave(x, y, &lo, &hi);
+    simd::Store(po + 2 * i, lo);
+    simd::Store(po + 2 * i + simd::WIDTH, hi);
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    float length = sqrtf(a[i].x * a[i].x + a[i].y * a[i].y);
+    out[i] = length > 0 ? ::Vector2{a[i].x / length, a[i].y / length} : ::Vector2{0, 0};
+  }
+}
+} // namespace Vector2Batch
+} // namespace raylib
+
+#endif
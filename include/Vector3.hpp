@@ -20,25 +20,22 @@ extern "C"
 
 namespace raylib
 {
+/**
+ * Vector3 type. Trivially copyable, and the arithmetic is constexpr, so vectors can be game constants.
+ */
 class Vector3 : public ::Vector3
 {
 public:
-  Vector3(::Vector3 vec)
-  {
-    set(vec);
-  };
-  Vector3(float X = 0, float Y = 0, float Z = 0)
-  {
-    x = X;
-    y = Y;
-    z = Z;
-  };
+  constexpr Vector3(const ::Vector3 &vec) : ::Vector3{vec.x, vec.y, vec.z} {}
 
-  Vector3(::Color color)
-  {
-    set(ColorToHSV(color));
-  }
-  inline void set(::Vector3 vec)
+  constexpr Vector3(float X = 0, float Y = 0, float Z = 0) : ::Vector3{X, Y, Z} {}
+
+  /**
+   * The hue, saturation and value of a color, see ::ColorToHSV().
+   */
+  explicit Vector3(::Color color) : Vector3{::ColorToHSV(color)} {}
+
+  constexpr void set(const ::Vector3 &vec)
   {
     x = vec.x;
     y = vec.y;
@@ -49,222 +46,203 @@ public:
   GETTERSETTER(float, Y, y)
   GETTERSETTER(float, Z, z)
 
-  Vector3 &operator=(const ::Vector3 &vector3)
+  constexpr Vector3 &operator=(const ::Vector3 &vector3)
   {
     set(vector3);
     return *this;
   }
 
-  Vector3 &operator=(const Vector3 &vector3)
+  constexpr bool operator==(const ::Vector3 &other) const
   {
-    set(vector3);
-    return *this;
+    return x == other.x && y == other.y && z == other.z;
   }
 
-  bool operator==(const Vector3 &other)
+  constexpr bool operator!=(const ::Vector3 &other) const
   {
-    return x == other.x && y == other.y && z == other.z;
+    return !(*this == other);
   }
 
 #ifndef RAYLIB_CPP_NO_MATH
-  Vector3 Add(const Vector3 &vector3)
+  constexpr Vector3 Add(const ::Vector3 &vector3) const
   {
-    return Vector3Add(*this, vector3);
+    return Vector3{x + vector3.x, y + vector3.y, z + vector3.z};
   }
 
-  Vector3 operator+(const Vector3 &vector3)
+  constexpr Vector3 operator+(const ::Vector3 &vector3) const
   {
-    return Vector3Add(*this, vector3);
+    return Add(vector3);
   }
 
-  Vector3 Subtract(const Vector3 &vector3)
+  constexpr Vector3 Subtract(const ::Vector3 &vector3) const
   {
-    return Vector3Subtract(*this, vector3);
+    return Vector3{x - vector3.x, y - vector3.y, z - vector3.z};
   }
 
-  Vector3 operator-(const Vector3 &vector3)
+  constexpr Vector3 operator-(const ::Vector3 &vector3) const
   {
-    return Vector3Subtract(*this, vector3);
+    return Subtract(vector3);
   }
 
-  Vector3 Negate()
+  constexpr Vector3 Negate() const
   {
-    return Vector3Negate(*this);
+    return Vector3{-x, -y, -z};
   }
 
-  Vector3 operator-()
+  constexpr Vector3 operator-() const
   {
-    return Vector3Negate(*this);
+    return Negate();
   }
 
-  Vector3 Multiply(const Vector3 &vector3)
+  constexpr Vector3 Multiply(const ::Vector3 &vector3) const
   {
-    return Vector3Multiply(*this, vector3);
+    return Vector3{x * vector3.x, y * vector3.y, z * vector3.z};
   }
 
-  Vector3 operator*(const Vector3 &vector3)
+  constexpr Vector3 operator*(const ::Vector3 &vector3) const
   {
-    return Vector3Multiply(*this, vector3);
+    return Multiply(vector3);
   }
 
-  Vector3 Scale(const float scale)
+  constexpr Vector3 Scale(const float scale) const
   {
-    return Vector3Scale(*this, scale);
+    return Vector3{x * scale, y * scale, z * scale};
   }
 
-  Vector3 operator*(const float scale)
+  constexpr Vector3 operator*(const float scale) const
   {
-    return Vector3Scale(*this, scale);
+    return Scale(scale);
   }
 
-  Vector3 Divide(const Vector3 &vector3)
+  constexpr Vector3 Divide(const ::Vector3 &vector3) const
   {
-    return Vector3Divide(*this, vector3);
+    return Vector3{x / vector3.x, y / vector3.y, z / vector3.z};
   }
 
-  Vector3 operator/(const Vector3 &vector3)
+  constexpr Vector3 operator/(const ::Vector3 &vector3) const
   {
-    return Vector3Divide(*this, vector3);
+    return Divide(vector3);
   }
 
-  Vector3 &Divide(const float div)
+  constexpr Vector3 Divide(const float div) const
   {
-    x /= div;
-    y /= div;
-    z /= div;
-
-    return *this;
+    return Vector3{x / div, y / div, z / div};
   }
 
-  Vector3 operator/(const float div)
+  constexpr Vector3 operator/(const float div) const
   {
     return Divide(div);
   }
 
-  Vector3 &operator+=(const Vector3 &vector3)
+  constexpr Vector3 &operator+=(const ::Vector3 &vector3)
   {
-    set(Vector3Add(*this, vector3));
-
-    return *this;
+    return *this = Add(vector3);
   }
 
-  Vector3 &operator-=(const Vector3 &vector3)
+  constexpr Vector3 &operator-=(const ::Vector3 &vector3)
   {
-    set(Vector3Subtract(*this, vector3));
-
-    return *this;
+    return *this = Subtract(vector3);
   }
 
-  Vector3 &operator*=(const Vector3 &vector3)
+  constexpr Vector3 &operator*=(const ::Vector3 &vector3)
   {
-    set(Vector3Multiply(*this, vector3));
-
-    return *this;
+    return *this = Multiply(vector3);
   }
 
-  Vector3 &operator*=(const float scale)
+  constexpr Vector3 &operator*=(const float scale)
   {
-    set(Vector3Scale(*this, scale));
-
-    return *this;
+    return *this = Scale(scale);
   }
 
-  Vector3 &operator/=(const Vector3 &vector3)
+  constexpr Vector3 &operator/=(const ::Vector3 &vector3)
   {
-    x /= vector3.x;
-    y /= vector3.y;
-    z /= vector3.z;
-
-    return *this;
+    return *this = Divide(vector3);
   }
 
-  Vector3 &operator/=(const float div)
+  constexpr Vector3 &operator/=(const float div)
   {
-    x /= div;
-    y /= div;
-    z /= div;
-
-    return *this;
+    return *this = Divide(div);
   }
 
-  float Length()
+  float Length() const
   {
     return Vector3Length(*this);
   }
 
-  Vector3 Normalize()
+  Vector3 Normalize() const
   {
     return Vector3Normalize(*this);
   }
 
-  float DotProduct(const Vector3 &vector3)
+  constexpr float DotProduct(const ::Vector3 &vector3) const
   {
-    return Vector3DotProduct(*this, vector3);
+    return x * vector3.x + y * vector3.y + z * vector3.z;
   }
 
-  float Distance(const Vector3 &vector3)
+  float Distance(const ::Vector3 &vector3) const
   {
     return Vector3Distance(*this, vector3);
   }
 
-  Vector3 Lerp(const Vector3 &vector3, const float amount)
+  constexpr Vector3 Lerp(const ::Vector3 &vector3, const float amount) const
   {
-    return Vector3Lerp(*this, vector3, amount);
+    return Vector3{x + amount * (vector3.x - x), y + amount * (vector3.y - y), z + amount * (vector3.z - z)};
   }
 
-  Vector3 CrossProduct(const Vector3 &vector3)
+  constexpr Vector3 CrossProduct(const ::Vector3 &vector3) const
   {
-    return Vector3CrossProduct(*this, vector3);
+    return Vector3{y * vector3.z - z * vector3.y, z * vector3.x - x * vector3.z, x * vector3.y - y * vector3.x};
   }
 
-  Vector3 Perpendicular()
+  Vector3 Perpendicular() const
   {
     return Vector3Perpendicular(*this);
   }
 
-  void OrthoNormalize(Vector3 *vector3)
+  void OrthoNormalize(::Vector3 *vector3)
   {
     return Vector3OrthoNormalize(this, vector3);
   }
 
-  Vector3 Transform(const ::Matrix &matrix)
+  constexpr Vector3 Transform(const ::Matrix &matrix) const
   {
-    return Vector3Transform(*this, matrix);
+    return Vector3{matrix.m0 * x + matrix.m4 * y + matrix.m8 * z + matrix.m12,
+                   matrix.m1 * x + matrix.m5 * y + matrix.m9 * z + matrix.m13,
+                   matrix.m2 * x + matrix.m6 * y + matrix.m10 * z + matrix.m14};
   }
 
-  Vector3 RotateByQuaternion(Quaternion quaternion)
+  Vector3 RotateByQuaternion(Quaternion quaternion) const
   {
     return Vector3RotateByQuaternion(*this, quaternion);
   }
 
-  Vector3 Reflect(const Vector3 &normal)
+  constexpr Vector3 Reflect(const ::Vector3 &normal) const
   {
-    return Vector3Reflect(*this, normal);
+    return Subtract(Vector3{normal}.Scale(2.0f * DotProduct(normal)));
   }
 
-  Vector3 Min(const Vector3 &vector3)
+  Vector3 Min(const ::Vector3 &vector3) const
   {
     return Vector3Min(*this, vector3);
   }
 
-  Vector3 Max(const Vector3 &vector3)
+  Vector3 Max(const ::Vector3 &vector3) const
   {
     return Vector3Max(*this, vector3);
   }
 
-  Vector3 Barycenter(const Vector3 &a, const Vector3 &b, const Vector3 &c)
+  Vector3 Barycenter(const ::Vector3 &a, const ::Vector3 &b, const ::Vector3 &c) const
   {
     return Vector3Barycenter(*this, a, b, c);
   }
 
-  static Vector3 Zero()
+  static constexpr Vector3 Zero()
   {
-    return Vector3Zero();
+    return Vector3{0, 0, 0};
   }
 
-  static Vector3 One()
+  static constexpr Vector3 One()
   {
-    return Vector3One();
+    return Vector3{1, 1, 1};
   }
 #endif
 
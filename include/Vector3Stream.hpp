@@ -0,0 +1,429 @@
+#ifndef RAYLIB_CPP_VECTOR3STREAM_HPP_
+#define RAYLIB_CPP_VECTOR3STREAM_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+#include "raylib.h"
+#ifdef __cplusplus
+}
+#endif
+
+#include "./Vector3.hpp"
+#include "./raylib-cpp-simd.hpp"
+
+namespace raylib
+{
+/**
+ * A run of Vector3s stored as three separate arrays of x, y and z (structure of arrays), each 32-byte aligned.
+ *
+ * ::Vector3 arrays interleave the components, so SIMD code over them spends much of its time shuffling. In a stream
+ * a register of x is one plain load, and every operation below runs WIDTH vectors at a time (see
+ * raylib-cpp-simd.hpp), finishing the last few with the same formula as raymath. Bring mesh vertices in once, run
+ * the bulk work here, and write them back.
+ */
+class Vector3Stream
+{
+public:
+  static const size_t ALIGNMENT = 32;
+
+  /**
+   * std::allocator, but ALIGNMENT-aligned.
+   */
+  template <typename T> struct AlignedAllocator
+  {
+    typedef T value_type;
+
+    AlignedAllocator() = default;
+    template <typename U> AlignedAllocator(const AlignedAllocator<U> &) {}
+
+    T *allocate(size_t count)
+    {
+      return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t(ALIGNMENT)));
+    }
+    void deallocate(T *p, size_t)
+    {
+      ::operator delete(p, std::align_val_t(ALIGNMENT));
+    }
+
+    template <typename U> bool operator==(const AlignedAllocator<U> &) const
+    {
+      return true;
+    }
+    template <typename U> bool operator!=(const AlignedAllocator<U> &) const
+    {
+      return false;
+    }
+  };
+
+  typedef std::vector<float, AlignedAllocator<float>> Array;
+
+  /**
+   * count zero vectors.
+   */
+  explicit Vector3Stream(size_t count = 0) : x(count), y(count), z(count) {}
+
+  /**
+   * A copy of count ::Vector3s (or raylib::Vector3s).
+   */
+  Vector3Stream(const ::Vector3 *vectors, size_t count) : x(count), y(count), z(count)
+  {
+    Load(vectors, count);
+  }
+
+  /**
+   * A copy of the mesh's vertex positions.
+   */
+  explicit Vector3Stream(const ::Mesh &mesh)
+      : Vector3Stream(reinterpret_cast<const ::Vector3 *>(mesh.vertices), mesh.vertices ? mesh.vertexCount : 0)
+  {
+  }
+
+  inline size_t size() const
+  {
+    return x.size();
+  }
+
+  inline bool empty() const
+  {
+    return x.empty();
+  }
+
+  /**
+   * Change the number of vectors, new ones are zero.
+   */
+  inline void Resize(size_t count)
+  {
+    x.resize(count);
+    y.resize(count);
+    z.resize(count);
+  }
+
+  inline float *GetX()
+  {
+    return x.data();
+  }
+  inline const float *GetX() const
+  {
+    return x.data();
+  }
+  inline float *GetY()
+  {
+    return y.data();
+  }
+  inline const float *GetY() const
+  {
+    return y.data();
+  }
+  inline float *GetZ()
+  {
+    return z.data();
+  }
+  inline const float *GetZ() const
+  {
+    return z.data();
+  }
+
+  inline Vector3 Get(size_t index) const
+  {
+    return Vector3{x[index], y[index], z[index]};
+  }
+
+  inline void Set(size_t index, const ::Vector3 &vector)
+  {
+    x[index] = vector.x;
+    y[index] = vector.y;
+    z[index] = vector.z;
+  }
+
+  /**
+   * Replace the stream with a copy of count ::Vector3s.
+   */
+  void Load(const ::Vector3 *vectors, size_t count)
+  {
+    Resize(count);
+    const float *in = &vectors->x;
+    size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+    for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+    {
+      simd::Lane vx, vy, vz;
+      simd::Load3(in + 3 * i, &vx, &vy, &vz);
+      simd::Store(&x[i], vx);
+      simd::Store(&y[i], vy);
+      simd::Store(&z[i], vz);
+    }
+#endif
+    for (; i < count; ++i)
+    {
+      x[i] = in[3 * i];
+      y[i] = in[3 * i + 1];
+      z[i] = in[3 * i + 2];
+    }
+  }
+
+  /**
+   * Write the first count vectors of the stream out as ::Vector3s, count is clamped to size().
+   */
+  void Store(::Vector3 *vectors, size_t count) const
+  {
+    float *out = &vectors->x;
+    count = std::min(count, size());
+    size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+    for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+    {
+      simd::Store3(out + 3 * i, simd::Load(&x[i]), simd::Load(&y[i]), simd::Load(&z[i]));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+      out[3 * i] = x[i];
+      out[3 * i + 1] = y[i];
+      out[3 * i + 2] = z[i];
+    }
+  }
+
+  inline void Store(::Vector3 *vectors) const
+  {
+    Store(vectors, size());
+  }
+
+  /**
+   * Write the stream back over the mesh's vertex positions, in the mesh's own buffer. Only the first
+   * min(size(), vertexCount) vertices are written, call ::UpdateMeshBuffer() to see them on the GPU.
+   */
+  inline void Store(::Mesh *mesh) const
+  {
+    if (mesh->vertices != nullptr && mesh->vertexCount > 0)
+    {
+      Store(reinterpret_cast<::Vector3 *>(mesh->vertices), (size_t)mesh->vertexCount);
+    }
+  }
+
+  /**
+   * out[i] = this[i] . other[i], as ::Vector3DotProduct(), for the first min(size(), other.size()) vectors.
+   */
+  void DotProduct(const Vector3Stream &other, float *out) const
+  {
+    size_t count = std::min(size(), other.size());
+    size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+    for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+    {
+      simd::Lane sum = simd::Add(simd::Mul(simd::Load(&x[i]), simd::Load(&other.x[i])),
+                                 simd::Mul(simd::Load(&y[i]), simd::Load(&other.y[i])));
+      simd::Store(out + i, simd::Add(sum, simd::Mul(simd::Load(&z[i]), simd::Load(&other.z[i]))));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+      out[i] = x[i] * other.x[i] + y[i] * other.y[i] + z[i] * other.z[i];
+    }
+  }
+
+  /**
+   * out[i] = this[i] . vector, as ::Vector3DotProduct()
+   */
+  void DotProduct(const ::Vector3 &vector, float *out) const
+  {
+    size_t count = size();
+    size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+    simd::Lane vx = simd::Set(vector.x), vy = simd::Set(vector.y), vz = simd::Set(vector.z);
+    for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+    {
+      simd::Lane sum = simd::Add(simd::Mul(simd::Load(&x[i]), vx), simd::Mul(simd::Load(&y[i]), vy));
+      simd::Store(out + i, simd::Add(sum, simd::Mul(simd::Load(&z[i]), vz)));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+      out[i] = x[i] * vector.x + y[i] * vector.y + z[i] * vector.z;
+    }
+  }
+
+  /**
+   * this[i] = this[i] x other[i], as ::Vector3CrossProduct(), for the first min(size(), other.size()) vectors.
+   * other may be this stream.
+   */
+  Vector3Stream &CrossProduct(const Vector3Stream &other)
+  {
+    size_t count = std::min(size(), other.size());
+    size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+    for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+    {
+      simd::Lane ax = simd::Load(&x[i]), ay = simd::Load(&y[i]), az = simd::Load(&z[i]);
+      simd::Lane bx = simd::Load(&other.x[i]), by = simd::Load(&other.y[i]), bz = simd::Load(&other.z[i]);
+      simd::Store(&x[i], simd::Sub(simd::Mul(ay, bz), simd::Mul(az, by)));
+      simd::Store(&y[i], simd::Sub(simd::Mul(az, bx), simd::Mul(ax, bz)));
+      simd::Store(&z[i], simd::Sub(simd::Mul(ax, by), simd::Mul(ay, bx)));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+      float ax = x[i], ay = y[i], az = z[i];
+      float bx = other.x[i], by = other.y[i], bz = other.z[i];
+      x[i] = ay * bz - az * by;
+      y[i] = az * bx - ax * bz;
+      z[i] = ax * by - ay * bx;
+    }
+    return *this;
+  }
+
+  /**
+   * this[i] = this[i] / |this[i]|, as ::Vector3Normalize(): a zero vector stays zero.
+   */
+  Vector3Stream &Normalize()
+  {
+    size_t count = size();
+    size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+    simd::Lane one = simd::Set(1.0f);
+    for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+    {
+      simd::Lane vx = simd::Load(&x[i]), vy = simd::Load(&y[i]), vz = simd::Load(&z[i]);
+      simd::Lane length =
+          simd::Sqrt(simd::Add(simd::Add(simd::Mul(vx, vx), simd::Mul(vy, vy)), simd::Mul(vz, vz)));
+      // raymath multiplies by the reciprocal, so the same is done here to round the same way
+      simd::Lane inverse = simd::WherePositive(length, simd::Div(one, length));
+      simd::Store(&x[i], simd::Mul(vx, inverse));
+      simd::Store(&y[i], simd::Mul(vy, inverse));
+      simd::Store(&z[i], simd::Mul(vz, inverse));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+      float length = sqrtf(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+      float inverse = 1.0f / (length == 0.0f ? 1.0f : length);
+      x[i] *= inverse;
+      y[i] *= inverse;
+      z[i] *= inverse;
+    }
+    return *this;
+  }
+
+  /**
+   * this[i] = ::Vector3Transform(this[i], matrix)
+   */
+  Vector3Stream &Transform(const ::Matrix &matrix)
+  {
+    size_t count = size();
+    size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+    simd::Lane c0 = simd::Set(matrix.m0), c4 = simd::Set(matrix.m4), c8 = simd::Set(matrix.m8);
+    simd::Lane c1 = simd::Set(matrix.m1), c5 = simd::Set(matrix.m5), c9 = simd::Set(matrix.m9);
+    simd::Lane c2 = simd::Set(matrix.m2), c6 = simd::Set(matrix.m6), c10 = simd::Set(matrix.m10);
+    simd::Lane c12 = simd::Set(matrix.m12), c13 = simd::Set(matrix.m13), c14 = simd::Set(matrix.m14);
+    for (; i + simd::WIDTH <= count; i += simd::WIDTH)
+    {
+      simd::Lane vx = simd::Load(&x[i]), vy = simd::Load(&y[i]), vz = simd::Load(&z[i]);
+      simd::Store(&x[i], Row(c0, c4, c8, vx, vy, vz, c12));
+      simd::Store(&y[i], Row(c1, c5, c9, vx, vy, vz, c13));
+      simd::Store(&z[i], Row(c2, c6, c10, vx, vy, vz, c14));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+      float vx = x[i], vy = y[i], vz = z[i];
+      x[i] = matrix.m0 * vx + matrix.m4 * vy + matrix.m8 * vz + matrix.m12;
+      y[i] = matrix.m1 * vx + matrix.m5 * vy + matrix.m9 * vz + matrix.m13;
+      z[i] = matrix.m2 * vx + matrix.m6 * vy + matrix.m10 * vz + matrix.m14;
+    }
+    return *this;
+  }
+
+  /**
+   * The component-wise minimum over the stream, zero if it is empty.
+   */
+  inline Vector3 Min() const
+  {
+    return GetBoundingBox().min;
+  }
+
+  /**
+   * The component-wise maximum over the stream, zero if it is empty.
+   */
+  inline Vector3 Max() const
+  {
+    return GetBoundingBox().max;
+  }
+
+  /**
+   * The smallest box holding every vector, the same box as ::MeshBoundingBox() gives for the mesh the stream was
+   * loaded from. Both corners are zero if the stream is empty.
+   */
+  ::BoundingBox GetBoundingBox() const
+  {
+    size_t count = size();
+    if (count == 0)
+    {
+      return ::BoundingBox{::Vector3{0, 0, 0}, ::Vector3{0, 0, 0}};
+    }
+    ::Vector3 min{x[0], y[0], z[0]};
+    ::Vector3 max = min;
+    size_t i = 0;
+#ifdef RAYLIB_CPP_SIMD
+    if (count >= (size_t)simd::WIDTH)
+    {
+      simd::Lane minX = simd::Load(&x[0]), minY = simd::Load(&y[0]), minZ = simd::Load(&z[0]);
+      simd::Lane maxX = minX, maxY = minY, maxZ = minZ;
+      for (i = simd::WIDTH; i + simd::WIDTH <= count; i += simd::WIDTH)
+      {
+        simd::Lane vx = simd::Load(&x[i]), vy = simd::Load(&y[i]), vz = simd::Load(&z[i]);
+        minX = simd::Min(minX, vx);
+        minY = simd::Min(minY, vy);
+        minZ = simd::Min(minZ, vz);
+        maxX = simd::Max(maxX, vx);
+        maxY = simd::Max(maxY, vy);
+        maxZ = simd::Max(maxZ, vz);
+      }
+      float lanes[6][simd::WIDTH];
+      simd::Store(lanes[0], minX);
+      simd::Store(lanes[1], minY);
+      simd::Store(lanes[2], minZ);
+      simd::Store(lanes[3], maxX);
+      simd::Store(lanes[4], maxY);
+      simd::Store(lanes[5], maxZ);
+      for (int lane = 0; lane < simd::WIDTH; ++lane)
+      {
+        min = ::Vector3{std::min(min.x, lanes[0][lane]), std::min(min.y, lanes[1][lane]),
+                        std::min(min.z, lanes[2][lane])};
+        max = ::Vector3{std::max(max.x, lanes[3][lane]), std::max(max.y, lanes[4][lane]),
+                        std::max(max.z, lanes[5][lane])};
+      }
+    }
+#endif
+    for (; i < count; ++i)
+    {
+      min = ::Vector3{std::min(min.x, x[i]), std::min(min.y, y[i]), std::min(min.z, z[i])};
+      max = ::Vector3{std::max(max.x, x[i]), std::max(max.y, y[i]), std::max(max.z, z[i])};
+    }
+    return ::BoundingBox{min, max};
+  }
+
+private:
+  Array x;
+  Array y;
+  Array z;
+
+#ifdef RAYLIB_CPP_SIMD
+  // a * x + b * y + c * z + d, added up in the same order as raymath does
+  static inline simd::Lane Row(simd::Lane a, simd::Lane b, simd::Lane c, simd::Lane vx, simd::Lane vy, simd::Lane vz,
+                               simd::Lane d)
+  {
+    return simd::Add(simd::Add(simd::Add(simd::Mul(a, vx), simd::Mul(b, vy)), simd::Mul(c, vz)), d);
+  }
+#endif
+};
+} // namespace raylib
+
+#endif
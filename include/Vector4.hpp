@@ -20,28 +20,22 @@ extern "C"
 
 namespace raylib
 {
+/**
+ * Vector4 type, also used as Quaternion. Trivially copyable, and the arithmetic is constexpr.
+ */
 class Vector4 : public ::Vector4
 {
 public:
-  Vector4(::Vector4 vec)
-  {
-    set(vec);
-  };
+  constexpr Vector4(const ::Vector4 &vec) : ::Vector4{vec.x, vec.y, vec.z, vec.w} {}
 
-  Vector4(float X = 0, float Y = 0, float Z = 0, float W = 0)
-  {
-    x = X;
-    y = Y;
-    z = Z;
-    w = W;
-  };
+  constexpr Vector4(float X = 0, float Y = 0, float Z = 0, float W = 0) : ::Vector4{X, Y, Z, W} {}
 
-  Vector4(::Color color)
-  {
-    set(ColorNormalize(color));
-  }
+  /**
+   * The color's components scaled to [0, 1], see ::ColorNormalize().
+   */
+  explicit Vector4(::Color color) : Vector4{::ColorNormalize(color)} {}
 
-  inline void set(::Vector4 vec4)
+  constexpr void set(const ::Vector4 &vec4)
   {
     x = vec4.x;
     y = vec4.y;
@@ -54,75 +48,86 @@ public:
   GETTERSETTER(float, Z, z)
   GETTERSETTER(float, W, w)
 
-  Vector4 &operator=(const ::Vector4 &vector4)
+  constexpr Vector4 &operator=(const ::Vector4 &vector4)
   {
     set(vector4);
     return *this;
   }
 
-  Vector4 &operator=(const Vector4 &vector4)
+  constexpr bool operator==(const ::Vector4 &other) const
   {
-    set(vector4);
-    return *this;
+    return x == other.x && y == other.y && z == other.z && w == other.w;
   }
 
-  bool operator==(const Vector4 &other)
+  constexpr bool operator!=(const ::Vector4 &other) const
   {
-    return x == other.x && y == other.y && z == other.z && w == other.w;
+    return !(*this == other);
   }
 
 #ifndef RAYLIB_CPP_NO_MATH
-  Vector4 Multiply(const Vector4 &vector4)
+  /**
+   * The Hamilton product, as ::QuaternionMultiply().
+   */
+  constexpr Vector4 Multiply(const ::Vector4 &vector4) const
+  {
+    return Vector4{x * vector4.w + w * vector4.x + y * vector4.z - z * vector4.y,
+                   y * vector4.w + w * vector4.y + z * vector4.x - x * vector4.z,
+                   z * vector4.w + w * vector4.z + x * vector4.y - y * vector4.x,
+                   w * vector4.w - x * vector4.x - y * vector4.y - z * vector4.z};
+  }
+
+  constexpr Vector4 operator*(const ::Vector4 &vector4) const
   {
-    return QuaternionMultiply(*this, vector4);
+    return Multiply(vector4);
   }
 
-  Vector4 operator*(const Vector4 &vector4)
+  constexpr Vector4 &operator*=(const ::Vector4 &vector4)
   {
-    return QuaternionMultiply(*this, vector4);
+    return *this = Multiply(vector4);
   }
 
-  Vector4 Lerp(const Vector4 &vector4, float amount)
+  constexpr Vector4 Lerp(const ::Vector4 &vector4, float amount) const
   {
-    return QuaternionLerp(*this, vector4, amount);
+    return Vector4{x + amount * (vector4.x - x), y + amount * (vector4.y - y), z + amount * (vector4.z - z),
+                   w + amount * (vector4.w - w)};
   }
 
-  Vector4 Nlerp(const Vector4 &vector4, float amount)
+  Vector4 Nlerp(const ::Vector4 &vector4, float amount) const
   {
     return QuaternionNlerp(*this, vector4, amount);
   }
 
-  Vector4 Slerp(const Vector4 &vector4, float amount)
+  Vector4 Slerp(const ::Vector4 &vector4, float amount) const
   {
     return QuaternionSlerp(*this, vector4, amount);
   }
 
-  Matrix ToMatrix()
+  Matrix ToMatrix() const
   {
     return QuaternionToMatrix(*this);
   }
 
-  float Length()
+  float Length() const
   {
     return QuaternionLength(*this);
   }
 
-  Vector4 Normalize()
+  Vector4 Normalize() const
   {
     return QuaternionNormalize(*this);
   }
 
-  Vector4 Invert()
+  Vector4 Invert() const
   {
     return QuaternionInvert(*this);
   }
 
-  void ToAxisAngle(Vector3 *outAxis, float *outAngle)
+  void ToAxisAngle(Vector3 *outAxis, float *outAngle) const
   {
     return QuaternionToAxisAngle(*this, outAxis, outAngle);
   }
 
-  std::pair<Vector3, float> ToAxisAngle()
+  std::pair<Vector3, float> ToAxisAngle() const
   {
     Vector3 outAxis;
     float outAngle;
@@ -134,14 +139,17 @@ public:
     return out;
   }
 
-  Vector4 Transform(const ::Matrix &matrix)
+  constexpr Vector4 Transform(const ::Matrix &matrix) const
   {
-    return ::QuaternionTransform(*this, matrix);
+    return Vector4{matrix.m0 * x + matrix.m4 * y + matrix.m8 * z + matrix.m12 * w,
+                   matrix.m1 * x + matrix.m5 * y + matrix.m9 * z + matrix.m13 * w,
+                   matrix.m2 * x + matrix.m6 * y + matrix.m10 * z + matrix.m14 * w,
+                   matrix.m3 * x + matrix.m7 * y + matrix.m11 * z + matrix.m15 * w};
   }
 
-  static Vector4 Identity()
+  static constexpr Vector4 Identity()
   {
-    return ::QuaternionIdentity();
+    return Vector4{0, 0, 0, 1};
   }
 
   static Vector4 FromVector3ToVector3(const Vector3 &from, const Vector3 &to)
@@ -169,13 +177,13 @@ public:
     return ::QuaternionFromEuler(vector3.x, vector3.y, vector3.z);
   }
 
-  Vector3 ToEuler()
+  Vector3 ToEuler() const
   {
     return ::QuaternionToEuler(*this);
   }
 #endif
 
-  inline Color ColorFromNormalized()
+  inline Color ColorFromNormalized() const
   {
     return ::ColorFromNormalized(*this);
   }
@@ -0,0 +1,467 @@
+#ifndef RAYLIB_CPP_SIMD_HPP_
+#define RAYLIB_CPP_SIMD_HPP_
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace raylib
+{
+/**
+ * The float vector operations the batch math kernels are written in, one register of WIDTH floats. Pixel kernels
+ * unpack WIDTH RGBA8 pixels into one register per channel with LoadColors() and compute on the floats.
+ *
+ * Picked at compile time: AVX2 (8 floats), SSE2 (4 floats) or AArch64 NEON (4 floats). Without any of them
+ * RAYLIB_CPP_SIMD is left undefined and the kernels only run their scalar loops. Every operation here is exact
+ * IEEE arithmetic (no reciprocal estimates), so a kernel gives the same results as its scalar loop, up to the fused
+ * multiply-adds the compiler may form in either.
+ */
+namespace simd
+{
+#if defined(__AVX2__)
+#define RAYLIB_CPP_SIMD 1
+typedef __m256 Lane;
+const int WIDTH = 8;
+
+inline Lane Load(const float *p)
+{
+  return _mm256_loadu_ps(p);
+}
+inline void Store(float *p, Lane a)
+{
+  _mm256_storeu_ps(p, a);
+}
+inline Lane Set(float a)
+{
+  return _mm256_set1_ps(a);
+}
+inline Lane SetPair(float a, float b)
+{
+  return _mm256_setr_ps(a, b, a, b, a, b, a, b);
+}
+inline Lane Add(Lane a, Lane b)
+{
+  return _mm256_add_ps(a, b);
+}
+inline Lane Sub(Lane a, Lane b)
+{
+  return _mm256_sub_ps(a, b);
+}
+inline Lane Mul(Lane a, Lane b)
+{
+  return _mm256_mul_ps(a, b);
+}
+inline Lane Div(Lane a, Lane b)
+{
+  return _mm256_div_ps(a, b);
+}
+inline Lane Sqrt(Lane a)
+{
+  return _mm256_sqrt_ps(a);
+}
+inline Lane Min(Lane a, Lane b)
+{
+  return _mm256_min_ps(a, b);
+}
+inline Lane Max(Lane a, Lane b)
+{
+  return _mm256_max_ps(a, b);
+}
+inline Lane Floor(Lane a)
+{
+  return _mm256_floor_ps(a);
+}
+// To the nearest integer, ties to even
+inline Lane Round(Lane a)
+{
+  return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+// value where length > 0, else 0
+inline Lane WherePositive(Lane length, Lane value)
+{
+  return _mm256_and_ps(_mm256_cmp_ps(length, _mm256_setzero_ps(), _CMP_GT_OQ), value);
+}
+// Masks of the lanes where a < b and where a == b, for Select()
+inline Lane Less(Lane a, Lane b)
+{
+  return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+}
+inline Lane Equal(Lane a, Lane b)
+{
+  return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+}
+// a where mask is set, else b
+inline Lane Select(Lane mask, Lane a, Lane b)
+{
+  return _mm256_blendv_ps(b, a, mask);
+}
+// Split two registers of x, y pairs into one of x and one of y. The order of the lanes is the same in both but is
+// not the memory order, Interleave() undoes it and Ordered() puts a lane-per-pair result in memory order.
+inline void Deinterleave(Lane lo, Lane hi, Lane *x, Lane *y)
+{
+  *x = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+  *y = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+}
+inline void Interleave(Lane x, Lane y, Lane *lo, Lane *hi)
+{
+  *lo = _mm256_unpacklo_ps(x, y);
+  *hi = _mm256_unpackhi_ps(x, y);
+}
+inline Lane Ordered(Lane a)
+{
+  return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(a), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+// Load WIDTH x, y, z triples into one register per component, in memory order; Store3() writes them back
+inline void Load3(const float *p, Lane *x, Lane *y, Lane *z)
+{
+  // Each 128-bit half gets four whole triples, then both halves are split the same way
+  Lane a0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + 12), 1);
+  Lane a1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 16), 1);
+  Lane a2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 20), 1);
+  Lane xy = _mm256_shuffle_ps(a1, a2, _MM_SHUFFLE(2, 1, 3, 2));
+  Lane yz = _mm256_shuffle_ps(a0, a1, _MM_SHUFFLE(1, 0, 2, 1));
+  *x = _mm256_shuffle_ps(a0, xy, _MM_SHUFFLE(2, 0, 3, 0));
+  *y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+  *z = _mm256_shuffle_ps(yz, a2, _MM_SHUFFLE(3, 0, 3, 1));
+}
+inline void Store3(float *p, Lane x, Lane y, Lane z)
+{
+  Lane xyLo = _mm256_unpacklo_ps(x, y);
+  Lane xyHi = _mm256_unpackhi_ps(x, y);
+  Lane a0 = _mm256_shuffle_ps(xyLo, _mm256_shuffle_ps(z, xyLo, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));
+  Lane a1 = _mm256_shuffle_ps(_mm256_shuffle_ps(xyLo, z, _MM_SHUFFLE(1, 1, 3, 3)), xyHi, _MM_SHUFFLE(1, 0, 2, 0));
+  Lane a2 = _mm256_shuffle_ps(_mm256_shuffle_ps(z, xyHi, _MM_SHUFFLE(2, 2, 2, 2)),
+                              _mm256_shuffle_ps(xyHi, z, _MM_SHUFFLE(3, 3, 3, 2)), _MM_SHUFFLE(2, 1, 2, 0));
+  _mm_storeu_ps(p, _mm256_castps256_ps128(a0));
+  _mm_storeu_ps(p + 4, _mm256_castps256_ps128(a1));
+  _mm_storeu_ps(p + 8, _mm256_castps256_ps128(a2));
+  _mm_storeu_ps(p + 12, _mm256_extractf128_ps(a0, 1));
+  _mm_storeu_ps(p + 16, _mm256_extractf128_ps(a1, 1));
+  _mm_storeu_ps(p + 20, _mm256_extractf128_ps(a2, 1));
+}
+// Transpose the 4x4 blocks in each 128-bit half
+inline void Transpose4(Lane *a0, Lane *a1, Lane *a2, Lane *a3)
+{
+  Lane t0 = _mm256_unpacklo_ps(*a0, *a1);
+  Lane t1 = _mm256_unpacklo_ps(*a2, *a3);
+  Lane t2 = _mm256_unpackhi_ps(*a0, *a1);
+  Lane t3 = _mm256_unpackhi_ps(*a2, *a3);
+  *a0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+  *a1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+  *a2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+  *a3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+// Load WIDTH x, y, z, w quadruples into one register per component, in memory order; Store4() writes them back
+inline void Load4(const float *p, Lane *x, Lane *y, Lane *z, Lane *w)
+{
+  *x = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + 16), 1);
+  *y = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 20), 1);
+  *z = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 24), 1);
+  *w = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 12)), _mm_loadu_ps(p + 28), 1);
+  Transpose4(x, y, z, w);
+}
+inline void Store4(float *p, Lane x, Lane y, Lane z, Lane w)
+{
+  Transpose4(&x, &y, &z, &w);
+  _mm_storeu_ps(p, _mm256_castps256_ps128(x));
+  _mm_storeu_ps(p + 4, _mm256_castps256_ps128(y));
+  _mm_storeu_ps(p + 8, _mm256_castps256_ps128(z));
+  _mm_storeu_ps(p + 12, _mm256_castps256_ps128(w));
+  _mm_storeu_ps(p + 16, _mm256_extractf128_ps(x, 1));
+  _mm_storeu_ps(p + 20, _mm256_extractf128_ps(y, 1));
+  _mm_storeu_ps(p + 24, _mm256_extractf128_ps(z, 1));
+  _mm_storeu_ps(p + 28, _mm256_extractf128_ps(w, 1));
+}
+// Load WIDTH RGBA8 pixels into one register per channel, as floats in [0, 255]
+inline void LoadColors(const unsigned char *p, Lane *r, Lane *g, Lane *b, Lane *a)
+{
+  __m256i rgba = _mm256_loadu_si256((const __m256i *)p);
+  __m256i byte = _mm256_set1_epi32(0xff);
+  *r = _mm256_cvtepi32_ps(_mm256_and_si256(rgba, byte));
+  *g = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(rgba, 8), byte));
+  *b = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(rgba, 16), byte));
+  *a = _mm256_cvtepi32_ps(_mm256_srli_epi32(rgba, 24));
+}
+// Store WIDTH RGBA8 pixels, each channel rounded to the nearest integer, which has to be in [0, 255]
+inline void StoreColors(unsigned char *p, Lane r, Lane g, Lane b, Lane a)
+{
+  __m256i rg = _mm256_or_si256(_mm256_cvtps_epi32(r), _mm256_slli_epi32(_mm256_cvtps_epi32(g), 8));
+  __m256i ba =
+      _mm256_or_si256(_mm256_slli_epi32(_mm256_cvtps_epi32(b), 16), _mm256_slli_epi32(_mm256_cvtps_epi32(a), 24));
+  _mm256_storeu_si256((__m256i *)p, _mm256_or_si256(rg, ba));
+}
+#elif defined(__SSE2__)
+#define RAYLIB_CPP_SIMD 1
+typedef __m128 Lane;
+const int WIDTH = 4;
+
+inline Lane Load(const float *p)
+{
+  return _mm_loadu_ps(p);
+}
+inline void Store(float *p, Lane a)
+{
+  _mm_storeu_ps(p, a);
+}
+inline Lane Set(float a)
+{
+  return _mm_set1_ps(a);
+}
+inline Lane SetPair(float a, float b)
+{
+  return _mm_setr_ps(a, b, a, b);
+}
+inline Lane Add(Lane a, Lane b)
+{
+  return _mm_add_ps(a, b);
+}
+inline Lane Sub(Lane a, Lane b)
+{
+  return _mm_sub_ps(a, b);
+}
+inline Lane Mul(Lane a, Lane b)
+{
+  return _mm_mul_ps(a, b);
+}
+inline Lane Div(Lane a, Lane b)
+{
+  return _mm_div_ps(a, b);
+}
+inline Lane Sqrt(Lane a)
+{
+  return _mm_sqrt_ps(a);
+}
+inline Lane Min(Lane a, Lane b)
+{
+  return _mm_min_ps(a, b);
+}
+inline Lane Max(Lane a, Lane b)
+{
+  return _mm_max_ps(a, b);
+}
+// SSE2 has no rounding instructions, these go through 32-bit integers and so only hold for |a| < 2^31
+inline Lane Floor(Lane a)
+{
+  Lane truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+  return _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, a), _mm_set1_ps(1)));
+}
+inline Lane Round(Lane a)
+{
+  return _mm_cvtepi32_ps(_mm_cvtps_epi32(a));
+}
+inline Lane WherePositive(Lane length, Lane value)
+{
+  return _mm_and_ps(_mm_cmpgt_ps(length, _mm_setzero_ps()), value);
+}
+inline Lane Less(Lane a, Lane b)
+{
+  return _mm_cmplt_ps(a, b);
+}
+inline Lane Equal(Lane a, Lane b)
+{
+  return _mm_cmpeq_ps(a, b);
+}
+inline Lane Select(Lane mask, Lane a, Lane b)
+{
+  return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+inline void Deinterleave(Lane lo, Lane hi, Lane *x, Lane *y)
+{
+  *x = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+  *y = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+}
+inline void Interleave(Lane x, Lane y, Lane *lo, Lane *hi)
+{
+  *lo = _mm_unpacklo_ps(x, y);
+  *hi = _mm_unpackhi_ps(x, y);
+}
+inline Lane Ordered(Lane a)
+{
+  return a;
+}
+inline void Load3(const float *p, Lane *x, Lane *y, Lane *z)
+{
+  Lane a0 = _mm_loadu_ps(p);
+  Lane a1 = _mm_loadu_ps(p + 4);
+  Lane a2 = _mm_loadu_ps(p + 8);
+  Lane xy = _mm_shuffle_ps(a1, a2, _MM_SHUFFLE(2, 1, 3, 2));
+  Lane yz = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(1, 0, 2, 1));
+  *x = _mm_shuffle_ps(a0, xy, _MM_SHUFFLE(2, 0, 3, 0));
+  *y = _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+  *z = _mm_shuffle_ps(yz, a2, _MM_SHUFFLE(3, 0, 3, 1));
+}
+inline void Store3(float *p, Lane x, Lane y, Lane z)
+{
+  Lane xyLo = _mm_unpacklo_ps(x, y);
+  Lane xyHi = _mm_unpackhi_ps(x, y);
+  _mm_storeu_ps(p, _mm_shuffle_ps(xyLo, _mm_shuffle_ps(z, xyLo, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)));
+  _mm_storeu_ps(p + 4, _mm_shuffle_ps(_mm_shuffle_ps(xyLo, z, _MM_SHUFFLE(1, 1, 3, 3)), xyHi, _MM_SHUFFLE(1, 0, 2, 0)));
+  _mm_storeu_ps(p + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, xyHi, _MM_SHUFFLE(2, 2, 2, 2)),
+                                      _mm_shuffle_ps(xyHi, z, _MM_SHUFFLE(3, 3, 3, 2)), _MM_SHUFFLE(2, 1, 2, 0)));
+}
+inline void Load4(const float *p, Lane *x, Lane *y, Lane *z, Lane *w)
+{
+  *x = _mm_loadu_ps(p);
+  *y = _mm_loadu_ps(p + 4);
+  *z = _mm_loadu_ps(p + 8);
+  *w = _mm_loadu_ps(p + 12);
+  _MM_TRANSPOSE4_PS(*x, *y, *z, *w);
+}
+inline void Store4(float *p, Lane x, Lane y, Lane z, Lane w)
+{
+  _MM_TRANSPOSE4_PS(x, y, z, w);
+  _mm_storeu_ps(p, x);
+  _mm_storeu_ps(p + 4, y);
+  _mm_storeu_ps(p + 8, z);
+  _mm_storeu_ps(p + 12, w);
+}
+inline void LoadColors(const unsigned char *p, Lane *r, Lane *g, Lane *b, Lane *a)
+{
+  __m128i rgba = _mm_loadu_si128((const __m128i *)p);
+  __m128i byte = _mm_set1_epi32(0xff);
+  *r = _mm_cvtepi32_ps(_mm_and_si128(rgba, byte));
+  *g = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(rgba, 8), byte));
+  *b = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(rgba, 16), byte));
+  *a = _mm_cvtepi32_ps(_mm_srli_epi32(rgba, 24));
+}
+inline void StoreColors(unsigned char *p, Lane r, Lane g, Lane b, Lane a)
+{
+  __m128i rg = _mm_or_si128(_mm_cvtps_epi32(r), _mm_slli_epi32(_mm_cvtps_epi32(g), 8));
+  __m128i ba = _mm_or_si128(_mm_slli_epi32(_mm_cvtps_epi32(b), 16), _mm_slli_epi32(_mm_cvtps_epi32(a), 24));
+  _mm_storeu_si128((__m128i *)p, _mm_or_si128(rg, ba));
+}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define RAYLIB_CPP_SIMD 1
+typedef float32x4_t Lane;
+const int WIDTH = 4;
+
+inline Lane Load(const float *p)
+{
+  return vld1q_f32(p);
+}
+inline void Store(float *p, Lane a)
+{
+  vst1q_f32(p, a);
+}
+inline Lane Set(float a)
+{
+  return vdupq_n_f32(a);
+}
+inline Lane SetPair(float a, float b)
+{
+  const float pair[4] = {a, b, a, b};
+  return vld1q_f32(pair);
+}
+inline Lane Add(Lane a, Lane b)
+{
+  return vaddq_f32(a, b);
+}
+inline Lane Sub(Lane a, Lane b)
+{
+  return vsubq_f32(a, b);
+}
+inline Lane Mul(Lane a, Lane b)
+{
+  return vmulq_f32(a, b);
+}
+inline Lane Div(Lane a, Lane b)
+{
+  return vdivq_f32(a, b);
+}
+inline Lane Sqrt(Lane a)
+{
+  return vsqrtq_f32(a);
+}
+inline Lane Min(Lane a, Lane b)
+{
+  return vminq_f32(a, b);
+}
+inline Lane Max(Lane a, Lane b)
+{
+  return vmaxq_f32(a, b);
+}
+inline Lane Floor(Lane a)
+{
+  return vrndmq_f32(a);
+}
+inline Lane Round(Lane a)
+{
+  return vrndnq_f32(a);
+}
+inline Lane WherePositive(Lane length, Lane value)
+{
+  return vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(length, vdupq_n_f32(0)), vreinterpretq_u32_f32(value)));
+}
+inline Lane Less(Lane a, Lane b)
+{
+  return vreinterpretq_f32_u32(vcltq_f32(a, b));
+}
+inline Lane Equal(Lane a, Lane b)
+{
+  return vreinterpretq_f32_u32(vceqq_f32(a, b));
+}
+inline Lane Select(Lane mask, Lane a, Lane b)
+{
+  return vbslq_f32(vreinterpretq_u32_f32(mask), a, b);
+}
+inline void Deinterleave(Lane lo, Lane hi, Lane *x, Lane *y)
+{
+  *x = vuzp1q_f32(lo, hi);
+  *y = vuzp2q_f32(lo, hi);
+}
+inline void Interleave(Lane x, Lane y, Lane *lo, Lane *hi)
+{
+  *lo = vzip1q_f32(x, y);
+  *hi = vzip2q_f32(x, y);
+}
+inline Lane Ordered(Lane a)
+{
+  return a;
+}
+inline void Load3(const float *p, Lane *x, Lane *y, Lane *z)
+{
+  float32x4x3_t a = vld3q_f32(p);
+  *x = a.val[0];
+  *y = a.val[1];
+  *z = a.val[2];
+}
+inline void Store3(float *p, Lane x, Lane y, Lane z)
+{
+  vst3q_f32(p, float32x4x3_t{{x, y, z}});
+}
+inline void Load4(const float *p, Lane *x, Lane *y, Lane *z, Lane *w)
+{
+  float32x4x4_t a = vld4q_f32(p);
+  *x = a.val[0];
+  *y = a.val[1];
+  *z = a.val[2];
+  *w = a.val[3];
+}
+inline void Store4(float *p, Lane x, Lane y, Lane z, Lane w)
+{
+  vst4q_f32(p, float32x4x4_t{{x, y, z, w}});
+}
+inline void LoadColors(const unsigned char *p, Lane *r, Lane *g, Lane *b, Lane *a)
+{
+  uint32x4_t rgba = vreinterpretq_u32_u8(vld1q_u8(p));
+  uint32x4_t byte = vdupq_n_u32(0xff);
+  *r = vcvtq_f32_u32(vandq_u32(rgba, byte));
+  *g = vcvtq_f32_u32(vandq_u32(vshrq_n_u32(rgba, 8), byte));
+  *b = vcvtq_f32_u32(vandq_u32(vshrq_n_u32(rgba, 16), byte));
+  *a = vcvtq_f32_u32(vshrq_n_u32(rgba, 24));
+}
+inline void StoreColors(unsigned char *p, Lane r, Lane g, Lane b, Lane a)
+{
+  uint32x4_t rg = vorrq_u32(vcvtnq_u32_f32(r), vshlq_n_u32(vcvtnq_u32_f32(g), 8));
+  uint32x4_t ba = vorrq_u32(vshlq_n_u32(vcvtnq_u32_f32(b), 16), vshlq_n_u32(vcvtnq_u32_f32(a), 24));
+  vst1q_u8(p, vreinterpretq_u8_u32(vorrq_u32(rg, ba)));
+}
+#endif
+} // namespace simd
+} // namespace raylib
+
+#endif
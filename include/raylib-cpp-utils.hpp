@@ -10,7 +10,7 @@
  * @param name The machine-readable name of the property.
  */
 #define GETTERSETTER(type, method, name)                                                                               \
-  inline type Get##method()                                                                                            \
+  inline type Get##method() const                                                                                      \
   {                                                                                                                    \
     return name;                                                                                                       \
   }                                                                                                                    \
@@ -55,15 +55,20 @@ namespace raylib
 }
 
 #include "./AudioDevice.hpp"
+#include "./AssetCache.hpp"
 #include "./AudioStream.hpp"
 #include "./BoundingBox.hpp"
 #include "./Camera2D.hpp"
 #include "./Camera3D.hpp"
 #include "./Color.hpp"
+#include "./ColorBatch.hpp"
 #include "./DroppedFiles.hpp"
 #include "./Font.hpp"
 #include "./Gamepad.hpp"
 #include "./Image.hpp"
+#include "./ImageLoader.hpp"
+#include "./ImagePipeline.hpp"
+#include "./MappedImage.hpp"
 #include "./Material.hpp"
 #include "./Matrix.hpp"
 #include "./Mesh.hpp"
@@ -76,10 +81,16 @@ namespace raylib
 #include "./Rectangle.hpp"
 #include "./RenderTexture2D.hpp"
 #include "./Shader.hpp"
+#include "./SoftwareRenderer.hpp"
 #include "./Sound.hpp"
+#include "./SpriteBatch.hpp"
 #include "./Texture2D.hpp"
+#include "./TextureAtlas.hpp"
+#include "./ThreadPool.hpp"
 #include "./Vector2.hpp"
+#include "./Vector2Batch.hpp"
 #include "./Vector3.hpp"
+#include "./Vector3Stream.hpp"
 #include "./Vector4.hpp"
 #include "./VrSimulator.hpp"
 #include "./Wave.hpp"
@@ -1,7 +1,14 @@
 #include "../include/raylib-cpp.hpp"
+#include "brick_field.hpp"
+#include "game_loop.hpp"
+#include "input_log.hpp"
+#include "random.hpp"
 #include "raylib.h"
+#include "swept_collision.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cstdio>
 #include <cmath>
 
 namespace
@@ -15,16 +22,22 @@ const int PLAYER_SPEED = 8;
 const int BALL_SIZE = 12;
 const int BALL_SPEED = 5;
 const int BRICK_WIDTH = 88, BRICK_HEIGHT = 46;
-const std::array<raylib::Rectangle, 6> BRICK_TEXTURE_POOL{
+const int TICKS_PER_SECOND = 120;
+const int MAX_BOUNCES_PER_TICK = 8;
+constexpr std::array<raylib::Rectangle, 6> BRICK_TEXTURE_POOL{
     raylib::Rectangle{0, 0, BRICK_WIDTH, BRICK_HEIGHT},     raylib::Rectangle{88, 96, BRICK_WIDTH, BRICK_HEIGHT},
     raylib::Rectangle{264, 51, BRICK_WIDTH, BRICK_HEIGHT},  raylib::Rectangle{264, 95, BRICK_WIDTH, BRICK_HEIGHT},
     raylib::Rectangle{440, 144, BRICK_WIDTH, BRICK_HEIGHT}, raylib::Rectangle{176, 145, BRICK_WIDTH, BRICK_HEIGHT},
 };
 
-raylib::Texture2D backgroundTexture;
-raylib::Texture2D bricksTexture;
-raylib::Texture2D playerTexture;
+raylib::ImageLoader imageLoader;
+raylib::TextureUploader uploader{imageLoader};
+raylib::AssetCache assets;
+raylib::AssetCache::Handle<raylib::Texture2D> backgroundTexture;
+raylib::TextureAtlas atlas;
+raylib::AssetCache::Handle<raylib::Texture2D> atlasTexture;
 std::array<raylib::Rectangle, BRICK_ROWS * BRICK_COLUMNS> brickTextures;
+raylib::SpriteBatch sprites{BRICK_ROWS * BRICK_COLUMNS + 1};
 
 struct Player
 {
@@ -56,68 +69,162 @@ struct Ball
   }
 };
 
-struct Brick
-{
-  raylib::Vector2 position; // brick center
-  bool shouldRender;
-
-  void Init(raylib::Vector2 position, bool shouldRender)
-  {
-    this->position = position;
-    this->shouldRender = shouldRender;
-  }
-};
-
 // Global Variables Declaration
 bool gameOver = false;
 bool pause = false;
 Player player;
 Ball ball;
-Brick brick[BRICK_ROWS][BRICK_COLUMNS];
-raylib::Vector2 brickSize;
+BrickField bricks{BRICK_COLUMNS, BRICK_ROWS, raylib::Vector2{0, BRICK_HEIGHT * 2},
+                  raylib::Vector2{BRICK_WIDTH, BRICK_HEIGHT}}; // two brick rows of margin on top
+
+// Where the player and ball were at the start of the last tick, for render interpolation
+float previousPlayerX = 0.0f;
+raylib::Vector2 previousBallPosition;
+
+Random rng;
+InputSession session{TICKS_PER_SECOND};
+FixedStepLoop loop{TICKS_PER_SECOND};
+
+// Window walls as slabs just outside the screen, the bottom is left open
+constexpr std::array<raylib::Rectangle, 3> WALLS{
+    raylib::Rectangle{-SCREEN_WIDTH, -SCREEN_HEIGHT, SCREEN_WIDTH, SCREEN_HEIGHT * 3},  // left
+    raylib::Rectangle{SCREEN_WIDTH, -SCREEN_HEIGHT, SCREEN_WIDTH, SCREEN_HEIGHT * 3},   // right
+    raylib::Rectangle{-SCREEN_WIDTH, -SCREEN_HEIGHT, SCREEN_WIDTH * 3, SCREEN_HEIGHT},  // top
+};
 
 // Function prototypes
 void InitGame();        // Initialize game
-void UpdateGame();      // Update game (one frame)
-void DrawGame();        // Draw game (one frame)
+void MoveBall();        // Move the ball for one tick, bouncing off whatever it meets
+void UpdateGame();      // Update game (one tick)
+void DrawGame(float);   // Draw game (one frame)
 void UpdateDrawFrame(); // Update and Draw (one frame)
 
 void InitGame()
 {
-  brickSize = raylib::Vector2{BRICK_WIDTH, BRICK_HEIGHT};
-
   player.Init(raylib::Vector2{SCREEN_WIDTH / 2, SCREEN_HEIGHT * 7 / 8}, raylib::Vector2{228, 25}, PLAYER_MAX_LIFE);
 
   ball.Init(raylib::Vector2{SCREEN_WIDTH / 2, SCREEN_HEIGHT * 7 / 8 - 30}, (raylib::Vector2){0, 0}, BALL_SIZE, false);
 
-  // Initialize bricks
-  int marginTop = brickSize.GetY() * 2;
+  previousPlayerX = player.position.GetX();
+  previousBallPosition = ball.position;
 
-  for (int i = 0; i < BRICK_ROWS; ++i)
-  {
-    for (int j = 0; j < BRICK_COLUMNS; ++j)
-    {
-      brick[i][j].Init(raylib::Vector2{(j + 0.5f) * brickSize.GetX(), (i + 0.5f) * brickSize.GetY() + marginTop}, true);
-    }
-  }
+  // Initialize bricks
+  bricks.Fill();
 
+  std::array<int, BRICK_ROWS * BRICK_COLUMNS> picks;
+  rng.Fill(picks.data(), picks.size(), 0, (int)BRICK_TEXTURE_POOL.size() - 1);
   for (int i = 0; i < BRICK_ROWS * BRICK_COLUMNS; ++i)
   {
-    brickTextures[i] = BRICK_TEXTURE_POOL[::GetRandomValue(0, (int)BRICK_TEXTURE_POOL.size() - 1)];
+    brickTextures[i] = BRICK_TEXTURE_POOL[picks[i]];
   }
 
   // Load textures
-  backgroundTexture = ::LoadTexture("../assets/hexagon_pattern.png");
-  bricksTexture = ::LoadTexture("../assets/bricks.png");
-  playerTexture = ::LoadTexture("../assets/player_bar.png");
+  // Both are still held from the last game on a restart, so the cache hands them back without loading anything
+  backgroundTexture = assets.LoadTextureAsync("../assets/hexagon_pattern.png", uploader);
+  atlasTexture = assets.LoadTexture("arkanoid atlas", []() {
+    atlas.Pack({{"bricks", "../assets/bricks.png"}, {"player_bar", "../assets/player_bar.png"}},
+                imageLoader);
+    return ::LoadTextureFromImage(atlas.GetImage());
+  });
 }
 
-// Update game variables (one frame)
+// Sweep the ball along its speed and stop at the first wall, paddle or brick it touches, bounce, then sweep the rest
+// of the tick from there. A fast ball therefore can't tunnel through a brick or skip the paddle between two ticks.
+void MoveBall()
+{
+  raylib::Rectangle playerRectangle{player.position.GetX() - player.size.GetX() / 2,
+                                    player.position.GetY() - player.size.GetY() / 2, player.size.GetX(),
+                                    player.size.GetY()};
+
+  float remaining = 1.0f;
+  for (int bounce = 0; bounce < MAX_BOUNCES_PER_TICK && remaining > 0; ++bounce)
+  {
+    ::Vector2 motion{ball.speed.GetX() * remaining, ball.speed.GetY() * remaining};
+    float radius = ball.radius;
+
+    SweepHit first;
+    bool hitPlayer = false;
+    int hitColumn = -1, hitRow = -1;
+    auto consider = [&](const ::Rectangle &rectangle) {
+      SweepHit hit = SweepCircleRec(ball.position, radius, motion, rectangle);
+      if (hit.hit && hit.time < first.time)
+      {
+        first = hit;
+        return true;
+      }
+      return false;
+    };
+
+    for (const raylib::Rectangle &wall : WALLS)
+    {
+      if (consider(wall))
+      {
+        hitPlayer = false;
+        hitColumn = -1;
+      }
+    }
+
+    // The ball only bounces off the player bar on its way down
+    if (ball.speed.GetY() > 0 && consider(playerRectangle))
+    {
+      hitPlayer = true;
+      hitColumn = -1;
+    }
+
+    // Only the bricks under the box swept by the ball can be hit
+    raylib::Rectangle swept{std::min(ball.position.GetX(), ball.position.GetX() + motion.x) - radius,
+                            std::min(ball.position.GetY(), ball.position.GetY() + motion.y) - radius,
+                            std::fabs(motion.x) + radius * 2, std::fabs(motion.y) + radius * 2};
+    bricks.ForEachLive(swept, [&](int column, int row) {
+      if (consider(bricks.BrickRectangle(column, row)))
+      {
+        hitPlayer = false;
+        hitColumn = column;
+        hitRow = row;
+      }
+    });
+
+    if (!first.hit)
+    {
+      ball.position.SetX(ball.position.GetX() + motion.x);
+      ball.position.SetY(ball.position.GetY() + motion.y);
+      break;
+    }
+
+    ball.position.SetX(ball.position.GetX() + motion.x * first.time);
+    ball.position.SetY(ball.position.GetY() + motion.y * first.time);
+    remaining *= 1.0f - first.time;
+
+    if (hitPlayer)
+    {
+      ball.speed.SetY(ball.speed.GetY() * -1);
+
+      // reflect with an angle
+      ball.speed.SetX((ball.position.GetX() - player.position.GetX()) / (player.size.GetX() / 2) * 5);
+    }
+    else
+    {
+      ball.speed = Reflect(ball.speed, first.normal);
+    }
+
+    if (hitColumn >= 0)
+    {
+      bricks.Clear(hitColumn, hitRow);
+    }
+  }
+}
+
+// Update game variables (one tick)
 void UpdateGame()
 {
+  TickInput input = session.NextTick();
+
+  previousPlayerX = player.position.GetX();
+  previousBallPosition = ball.position;
+
   if (!gameOver)
   {
-    if (::IsKeyPressed(::KEY_P))
+    if (input.Pressed(INPUT_PAUSE))
     {
       pause = !pause;
     }
@@ -137,10 +244,10 @@ void UpdateGame()
       //   player.position.SetX(player.position.GetX() + PLAYER_SPEED);
       // }
 
-      player.position.SetX(::GetMouseX());
+      player.position.SetX(input.mouseX);
 
       // Ball launching logic
-      if (!ball.shouldRender && (::IsKeyPressed(::KEY_SPACE) || ::IsMouseButtonPressed(::MOUSE_LEFT_BUTTON)))
+      if (!ball.shouldRender && (input.Pressed(INPUT_SPACE) || input.Pressed(INPUT_MOUSE_LEFT)))
       {
         ball.shouldRender = true;
         ball.speed = raylib::Vector2{0, -BALL_SPEED}; // straight up
@@ -149,8 +256,7 @@ void UpdateGame()
       // Ball movement logic
       if (ball.shouldRender)
       {
-        ball.position.SetX(ball.position.GetX() + ball.speed.GetX());
-        ball.position.SetY(ball.position.GetY() + ball.speed.GetY());
+        MoveBall();
       }
       else
       {
@@ -158,15 +264,6 @@ void UpdateGame()
             (raylib::Vector2){player.position.GetX(), SCREEN_HEIGHT * 7 / 8 - 30}; // return to player position
       }
 
-      // Collision logic: ball vs window walls
-      if (((ball.position.GetX() + ball.radius) >= SCREEN_WIDTH) || ((ball.position.GetX() - ball.radius) <= 0))
-      {
-        ball.speed.SetX(ball.speed.GetX() * -1);
-      }
-      if ((ball.position.GetY() - ball.radius) <= 0)
-      {
-        ball.speed.SetY(ball.speed.GetY() * -1);
-      }
       if ((ball.position.GetY() + ball.radius) >= SCREEN_HEIGHT) // drop below window
       {
         ball.speed = (raylib::Vector2){0, 0};
@@ -175,103 +272,20 @@ void UpdateGame()
         --player.life;
       }
 
-      // Collision logic: ball vs player
-      raylib::Rectangle playerRectangle{player.position.GetX() - player.size.GetX() / 2,
-                                        player.position.GetY() - player.size.GetY() / 2, player.size.GetX(),
-                                        player.size.GetY()};
-      if (::CheckCollisionCircleRec(ball.position, ball.radius, playerRectangle))
-      {
-        if (ball.speed.GetY() > 0)
-        {
-          ball.speed.SetY(ball.speed.GetY() * -1);
-
-          // reflect with an angle
-          ball.speed.SetX((ball.position.GetX() - player.position.GetX()) / (player.size.GetX() / 2) * 5);
-        }
-      }
-
-      // Collision logic: ball vs bricks
-      for (int i = 0; i < BRICK_ROWS; ++i)
-      {
-        for (int j = 0; j < BRICK_COLUMNS; ++j)
-        {
-          Brick currBrick = brick[i][j];
-          if (currBrick.shouldRender)
-          {
-            int ballTop = ball.position.GetY() - ball.radius;
-            int ballBottom = ball.position.GetY() + ball.radius;
-            int ballLeft = ball.position.GetX() - ball.radius;
-            int ballRight = ball.position.GetX() + ball.radius;
-            int brickTop = currBrick.position.GetY() - brickSize.GetY() / 2;
-            int brickBottom = currBrick.position.GetY() + brickSize.GetY() / 2;
-            int brickLeft = currBrick.position.GetX() - brickSize.GetX() / 2;
-            int brickRight = currBrick.position.GetX() + brickSize.GetX() / 2;
-
-            // Hit below
-            if ((ballTop <= brickBottom) && (ballTop > brickBottom + ball.speed.GetY()) &&
-                (std::fabs(ball.position.GetX() - brick[i][j].position.GetX()) <
-                 (brickSize.GetX() / 2 + ball.radius * 2 / 3)) &&
-                (ball.speed.GetY() < 0))
-            {
-              brick[i][j].shouldRender = false;
-              ball.speed.SetY(ball.speed.GetY() * -1);
-            }
-            // Hit above
-            else if ((ballBottom >= brickTop) && (ballBottom < brickTop + ball.speed.GetY()) &&
-                     ((std::fabs(ball.position.GetX() - brick[i][j].position.GetX())) <
-                      (brickSize.GetX() / 2 + ball.radius * 2 / 3)) &&
-                     (ball.speed.GetY() > 0))
-            {
-              brick[i][j].shouldRender = false;
-              ball.speed.SetY(ball.speed.GetY() * -1);
-            }
-            // Hit left
-            else if ((ballRight >= brickLeft) && (ballRight < brickLeft + ball.speed.GetX()) &&
-                     ((std::fabs(ball.position.GetY() - brick[i][j].position.GetY())) <
-                      (brickSize.GetY() / 2 + ball.radius * 2 / 3)) &&
-                     (ball.speed.GetX() > 0))
-            {
-              brick[i][j].shouldRender = false;
-              ball.speed.SetX(ball.speed.GetX() * -1);
-            }
-            // Hit right
-            else if ((ballLeft <= brickRight) && (ballLeft > brickRight + ball.speed.GetX()) &&
-                     ((std::fabs(ball.position.GetY() - brick[i][j].position.GetY())) <
-                      (brickSize.GetY() / 2 + ball.radius * 2 / 3)) &&
-                     (ball.speed.GetX() < 0))
-            {
-              brick[i][j].shouldRender = false;
-              ball.speed.SetX(ball.speed.GetX() * -1);
-            }
-          }
-        }
-      }
-
       // Game over logic
       if (player.life <= 0)
       {
         gameOver = true;
       }
-      else
+      else if (bricks.LiveCount() == 0)
       {
         gameOver = true;
-        for (int i = 0; i < BRICK_ROWS; ++i)
-        {
-          for (int j = 0; j < BRICK_COLUMNS; ++j)
-          {
-            if (brick[i][j].shouldRender)
-            {
-              gameOver = false;
-              break;
-            }
-          }
-        }
       }
     }
   }
   else
   {
-    if (::IsKeyPressed(::KEY_ENTER))
+    if (input.Pressed(INPUT_ENTER))
     {
       InitGame();
       gameOver = false;
@@ -279,14 +293,14 @@ void UpdateGame()
   }
 }
 
-// Draw game (one frame)
-void DrawGame()
+// Draw game (one frame), blend is how far we are between the last tick and the next one
+void DrawGame(float blend)
 {
   ::BeginDrawing();
 
   ::ClearBackground(::RAYWHITE);
 
-  backgroundTexture.Draw(raylib::Vector2{0, 0}, 0.0f, 5.0f, ::WHITE);
+  backgroundTexture->Draw(raylib::Vector2{0, 0}, 0.0f, 5.0f, ::WHITE);
 
   if (!gameOver)
   {
@@ -304,32 +318,24 @@ void DrawGame()
     }
 
     // Draw player bar
-    playerTexture.Draw(raylib::Rectangle{0, 0, 228, 25},
-                       raylib::Vector2{player.position.GetX() - player.size.GetX() / 2,
-                                       player.position.GetY() - player.size.GetY() / 2},
-                       ::RAYWHITE);
+    float playerX = LerpFloat(previousPlayerX, player.position.GetX(), blend);
+    float playerY = player.position.GetY();
+    sprites.Add(*atlasTexture, atlas.Get("player_bar", raylib::Rectangle{0, 0, 228, 25}),
+                raylib::Vector2{playerX - player.size.GetX() / 2, playerY - player.size.GetY() / 2}, ::RAYWHITE);
+
+    // Draw the standing bricks on screen, in the same batch as the player bar
+    bricks.ForEachLive(raylib::Rectangle{0, 0, SCREEN_WIDTH, SCREEN_HEIGHT}, [](int column, int row) {
+      ::Rectangle brick = bricks.BrickRectangle(column, row);
+      sprites.Add(*atlasTexture, atlas.Get("bricks", brickTextures[row * BRICK_COLUMNS + column]),
+                  raylib::Vector2{brick.x, brick.y}, ::RAYWHITE);
+    });
+    sprites.Flush();
 
     // Draw ball
-    ::DrawCircleGradient(ball.position.GetX(), ball.position.GetY(), ball.radius, ::WHITE,
+    ::DrawCircleGradient(LerpFloat(previousBallPosition.GetX(), ball.position.GetX(), blend),
+                         LerpFloat(previousBallPosition.GetY(), ball.position.GetY(), blend), ball.radius, ::WHITE,
                          ::RAYWHITE);
 
-    // Draw bricks
-    int k = 0;
-    for (int i = 0; i < BRICK_ROWS; ++i)
-    {
-      for (int j = 0; j < BRICK_COLUMNS; ++j)
-      {
-        if (brick[i][j].shouldRender)
-        {
-          bricksTexture.Draw(brickTextures[k],
-                             raylib::Vector2{brick[i][j].position.GetX() - brickSize.GetX() / 2,
-                                             brick[i][j].position.GetY() - brickSize.GetY() / 2},
-                             ::RAYWHITE);
-        }
-        ++k;
-      }
-    }
-
     if (pause)
     {
       ::DrawText("GAME PAUSED", SCREEN_WIDTH / 2 - MeasureText("GAME PAUSED", 40) / 2, SCREEN_HEIGHT / 2 - 40, 40,
@@ -349,24 +355,34 @@ void DrawGame()
 // Update and Draw (one frame)
 void UpdateDrawFrame()
 {
-  UpdateGame();
-  DrawGame();
+  session.Poll();
+  uploader.Update();
+  float blend = loop.Advance(::GetFrameTime(), UpdateGame);
+  DrawGame(blend);
 }
 
 } // namespace
 
-int main()
+int main(int argc, char **argv)
 {
+  session.Open(argc, argv);
   raylib::Window window{SCREEN_WIDTH, SCREEN_HEIGHT, "Sample game: Arkanoid"};
-
+  session.SeedRandom(rng);
   InitGame();
-
   ::SetTargetFPS(120);
 
+  if (session.IsReplay())
+  {
+    session.Replay(UpdateGame);
+    std::printf("lives %d, game over %d\n", player.life, gameOver);
+    return 0;
+  }
+
   while (!window.ShouldClose())
   {
     UpdateDrawFrame();
   }
 
+  session.Finish();
   return 0;
 }
@@ -0,0 +1,152 @@
+#ifndef BRICK_FIELD_HPP_
+#define BRICK_FIELD_HPP_
+
+#include "raylib.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// A wall of equally sized bricks on a regular grid, one bit per brick, set while the brick is still standing.
+//
+// Each row is a run of 64-bit words, so a brick lookup is one bit test and visiting the live bricks under an area
+// turns the area into a column and row range and walks only those bits. The cost of a query depends on the area, not
+// on the size of the wall, and a live-brick count is kept up to date so "is the wall cleared?" is O(1) too.
+class BrickField
+{
+public:
+  BrickField(int columns, int rows, ::Vector2 origin, ::Vector2 brickSize)
+      : columns{columns}, rows{rows}, wordsPerRow{(columns + 63) / 64}, origin{origin}, brickSize{brickSize},
+        bits((size_t)wordsPerRow * rows), rowLive(rows)
+  {
+    Fill();
+  }
+
+  int Columns() const
+  {
+    return columns;
+  }
+
+  int Rows() const
+  {
+    return rows;
+  }
+
+  ::Vector2 BrickSize() const
+  {
+    return brickSize;
+  }
+
+  long long LiveCount() const
+  {
+    return liveCount;
+  }
+
+  int RowLiveCount(int row) const
+  {
+    return rowLive[row];
+  }
+
+  bool IsLive(int column, int row) const
+  {
+    return (bits[(size_t)row * wordsPerRow + (column >> 6)] >> (column & 63)) & 1;
+  }
+
+  ::Rectangle BrickRectangle(int column, int row) const
+  {
+    return ::Rectangle{origin.x + column * brickSize.x, origin.y + row * brickSize.y, brickSize.x, brickSize.y};
+  }
+
+  // Stand every brick back up
+  void Fill()
+  {
+    for (int row = 0; row < rows; ++row)
+    {
+      uint64_t *words = &bits[(size_t)row * wordsPerRow];
+      std::fill(words, words + wordsPerRow, ~uint64_t{0});
+      if ((columns & 63) != 0)
+      {
+        words[wordsPerRow - 1] = ~(~uint64_t{0} << (columns & 63)); // columns past the wall stay empty
+      }
+      rowLive[row] = columns;
+    }
+    liveCount = (long long)columns * rows;
+  }
+
+  // Knock a brick down, returns whether it was standing
+  bool Clear(int column, int row)
+  {
+    uint64_t &word = bits[(size_t)row * wordsPerRow + (column >> 6)];
+    uint64_t bit = uint64_t{1} << (column & 63);
+    if ((word & bit) == 0)
+    {
+      return false;
+    }
+    word &= ~bit;
+    --rowLive[row];
+    --liveCount;
+    return true;
+  }
+
+  // Call visit(column, row) for every standing brick that overlaps or touches area, row by row. Bricks may be
+  // cleared from inside visit.
+  template <typename Visit> void ForEachLive(const ::Rectangle &area, Visit &&visit) const
+  {
+    int firstColumn = std::max(0, cellOf(area.x, origin.x, brickSize.x, columns));
+    int lastColumn = std::min(columns - 1, cellOf(area.x + area.width, origin.x, brickSize.x, columns));
+    int firstRow = std::max(0, cellOf(area.y, origin.y, brickSize.y, rows));
+    int lastRow = std::min(rows - 1, cellOf(area.y + area.height, origin.y, brickSize.y, rows));
+    if (firstColumn > lastColumn || firstRow > lastRow)
+    {
+      return;
+    }
+
+    int firstWord = firstColumn >> 6, lastWord = lastColumn >> 6;
+    uint64_t firstMask = ~uint64_t{0} << (firstColumn & 63);
+    uint64_t lastMask = ~uint64_t{0} >> (63 - (lastColumn & 63));
+    for (int row = firstRow; row <= lastRow; ++row)
+    {
+      if (rowLive[row] == 0)
+      {
+        continue;
+      }
+
+      const uint64_t *words = &bits[(size_t)row * wordsPerRow];
+      for (int w = firstWord; w <= lastWord; ++w)
+      {
+        uint64_t word = words[w];
+        if (w == firstWord)
+        {
+          word &= firstMask;
+        }
+        if (w == lastWord)
+        {
+          word &= lastMask;
+        }
+        for (; word != 0; word &= word - 1)
+        {
+          visit(w * 64 + __builtin_ctzll(word), row);
+        }
+      }
+    }
+  }
+
+private:
+  int columns;
+  int rows;
+  int wordsPerRow;
+  ::Vector2 origin; // top left corner of the wall
+  ::Vector2 brickSize;
+  std::vector<uint64_t> bits; // row-major, wordsPerRow words per row
+  std::vector<int> rowLive;   // standing bricks per row, lets queries skip cleared rows
+  long long liveCount = 0;
+
+  // Grid coordinate of a position, clamped to one past either end so an area off the wall gives an empty range
+  static int cellOf(float position, float start, float size, int count)
+  {
+    return (int)std::clamp(std::floor((position - start) / size), -1.0f, (float)count);
+  }
+};
+
+#endif
@@ -0,0 +1,192 @@
+#ifndef ENTITY_POOL_HPP_
+#define ENTITY_POOL_HPP_
+
+#include "../include/raylib-cpp.hpp"
+#include "object_pool.hpp"
+#include "raylib.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Structure-of-arrays storage for axis-aligned moving entities (enemies, bullets).
+//
+// Positions, sizes and speeds live in separate contiguous float arrays and liveness in a bitmask, so the per-tick
+// passes below stream only the fields they read and compile to plain vector loops. Slots come from a SlotAllocator,
+// so spawning and despawning are O(1) and per-entity loops visit live slots only. Anything only the renderer needs
+// (colours, textures) is kept by the owner in its own array, indexed by the same slot.
+class EntityPool
+{
+public:
+  std::vector<float> x, y, w, h, speed;
+  std::vector<float> prevX, prevY; // position at the start of the last tick, for render interpolation
+
+  explicit EntityPool(int capacity)
+      : x(paddedSize(capacity)), y(paddedSize(capacity)), w(paddedSize(capacity)), h(paddedSize(capacity)),
+        speed(paddedSize(capacity)), prevX(paddedSize(capacity)), prevY(paddedSize(capacity)),
+        active(paddedSize(capacity) / 64, 0), allocator{capacity}
+  {
+  }
+
+  int Capacity() const
+  {
+    return allocator.Capacity();
+  }
+
+  int Size() const
+  {
+    return allocator.Size();
+  }
+
+  // Returns the slot of the new entity, or -1 when the pool is full
+  int Acquire(const ::Rectangle &rec, float entitySpeed)
+  {
+    int i = allocator.Acquire();
+    if (i >= 0)
+    {
+      x[i] = prevX[i] = rec.x;
+      y[i] = prevY[i] = rec.y;
+      w[i] = rec.width;
+      h[i] = rec.height;
+      speed[i] = entitySpeed;
+      active[i >> 6] |= uint64_t{1} << (i & 63);
+    }
+    return i;
+  }
+
+  void Release(int i)
+  {
+    allocator.Release(i);
+    active[i >> 6] &= ~(uint64_t{1} << (i & 63));
+  }
+
+  void Clear()
+  {
+    allocator.Clear();
+    std::fill(active.begin(), active.end(), 0);
+  }
+
+  ::Rectangle Rec(int i) const
+  {
+    return ::Rectangle{x[i], y[i], w[i], h[i]};
+  }
+
+  bool IsLive(int i) const
+  {
+    return (active[i >> 6] >> (i & 63)) & 1;
+  }
+
+  // Teleport an entity; it is drawn at the new spot right away instead of sliding there
+  void SetPosition(int i, float newX, float newY)
+  {
+    x[i] = prevX[i] = newX;
+    y[i] = prevY[i] = newY;
+  }
+
+  // Position blended between the previous and the current tick, blend in [0, 1]
+  ::Vector2 Interpolated(int i, float blend) const
+  {
+    return ::Vector2{prevX[i] + (x[i] - prevX[i]) * blend, prevY[i] + (y[i] - prevY[i]) * blend};
+  }
+
+  // Call visit(i) for every live slot; the visitor may release the slot it is given
+  template <typename Visitor> void ForEachLive(Visitor &&visit) const
+  {
+    allocator.ForEachLive(visit);
+  }
+
+  // Move every slot up to the high-water mark by direction * speed along x, remembering where it was. Dead slots
+  // drift too, which is harmless since acquiring a slot always sets its position, and it keeps the loop branch-free.
+  void MoveX(float direction)
+  {
+    float *px = x.data();
+    float *ppx = prevX.data();
+    const float *ps = speed.data();
+    int count = allocator.HighWater();
+    for (int i = 0; i < count; ++i)
+    {
+      ppx[i] = px[i];
+      px[i] += direction * ps[i];
+    }
+    std::copy(y.begin(), y.begin() + count, prevY.begin());
+  }
+
+  // Append the live slots whose right edge is left of limit
+  void CollectLeftOf(float limit, std::vector<int> &out) const
+  {
+    collect(out, [limit](const float *px, const float *, const float *pw, const float *, int i) {
+      return px[i] + pw[i] < limit;
+    });
+  }
+
+  // Append the live slots whose right edge reached limit
+  void CollectRightOf(float limit, std::vector<int> &out) const
+  {
+    collect(out, [limit](const float *px, const float *, const float *pw, const float *, int i) {
+      return px[i] + pw[i] >= limit;
+    });
+  }
+
+  // Append the live slots that overlap rec, same test as ::CheckCollisionRecs
+  void CollectOverlapping(const ::Rectangle &rec, std::vector<int> &out) const
+  {
+    float left = rec.x, right = rec.x + rec.width, top = rec.y, bottom = rec.y + rec.height;
+    collect(out, [=](const float *px, const float *py, const float *pw, const float *ph, int i) {
+      return (px[i] < right) & (px[i] + pw[i] > left) & (py[i] < bottom) & (py[i] + ph[i] > top);
+    });
+  }
+
+private:
+  std::vector<uint64_t> active;
+  SlotAllocator allocator;
+
+  // Round up to whole 64-slot blocks, one active word each
+  static size_t paddedSize(int capacity)
+  {
+    return ((size_t)capacity + 63) / 64 * 64;
+  }
+
+  // Evaluate test over 64-slot blocks up to the high-water mark into a hit mask, then walk only the set bits that
+  // are also live
+  template <typename Test> void collect(std::vector<int> &out, Test test) const
+  {
+    int count = allocator.HighWater();
+    const float *px = x.data();
+    const float *py = y.data();
+    const float *pw = w.data();
+    const float *ph = h.data();
+
+    for (int base = 0; base < count; base += 64)
+    {
+      // Storage is padded to whole blocks, so every block runs the same fixed-width loop the compiler can vectorize
+      uint8_t flags[64];
+      for (int k = 0; k < 64; ++k)
+      {
+        flags[k] = test(px + base, py + base, pw + base, ph + base, k);
+      }
+
+      // Pack eight 0/1 bytes at a time into eight bits
+      uint64_t hits = 0;
+      for (int k = 0; k < 64; k += 8)
+      {
+        uint64_t chunk;
+        std::memcpy(&chunk, flags + k, sizeof(chunk));
+        hits |= ((chunk * 0x0102040810204080ull) >> 56) << k;
+      }
+
+      hits &= active[base >> 6];
+      if (count - base < 64)
+      {
+        hits &= (uint64_t{1} << (count - base)) - 1;
+      }
+
+      for (; hits != 0; hits &= hits - 1)
+      {
+        out.push_back(base + __builtin_ctzll(hits));
+      }
+    }
+  }
+};
+
+#endif
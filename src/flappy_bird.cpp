@@ -1,8 +1,13 @@
 #include "../include/raylib-cpp.hpp"
+#include "game_loop.hpp"
+#include "input_log.hpp"
+#include "random.hpp"
+#include "object_pool.hpp"
 #include "raylib.h"
 
 #include <algorithm>
 #include <array>
+#include <cstdio>
 #include <iostream>
 
 namespace
@@ -13,29 +18,34 @@ const int SCREEN_HEIGHT = 450;
 double Y_speed = 0.0;
 const double GRAVITATIONAL_ACCELRATION = 0.07;
 const double BOUNCE_FORCE = -1.2;
-const int MAX_TUBES = 100;
+const int MAX_TUBES = 100;     // tube pairs in one run
+const int MAX_LIVE_TUBES = 8; // tube pairs alive at once, a screen holds at most four
 const int FLAPPY_RADIUS = 18;
 const int TUBES_WIDTH = 50;
 const float JUMP_HEIGHT = 1.5f;
 const int TUBE_SPEED = 1;
+const int TUBE_SPACING = 280;
+const int TICKS_PER_SECOND = 120;
 
 struct Flappy
 {
   raylib::Vector2 position;
+  raylib::Vector2 previousPosition; // position at the start of the last tick
   int radius;
   raylib::Color color;
 
   Flappy(raylib::Vector2 _position, int _radius, raylib::Color _color)
-      : position{_position}, radius{_radius}, color{_color}
+      : position{_position}, previousPosition{_position}, radius{_radius}, color{_color}
   {
   }
 };
 
-struct Tubes
+struct TubePair
 {
-  raylib::Rectangle rec;
-  raylib::Color color;
-  bool active;
+  raylib::Rectangle top;
+  raylib::Rectangle bottom;
+  bool scored;
+  float previousX; // top.x and bottom.x at the start of the last tick
 };
 
 bool isGameOver = false;
@@ -47,20 +57,30 @@ float alpha = 0.0f;
 bool isOpaque = false;
 
 Flappy flappy{raylib::Vector2{80, (float)(SCREEN_HEIGHT / 2 - FLAPPY_RADIUS)}, FLAPPY_RADIUS, ::DARKGRAY};
-std::array<Tubes, MAX_TUBES * 2> tubes;
-std::array<raylib::Vector2, MAX_TUBES> tubesPos;
-
-raylib::Texture2D backgroundTexture;
-raylib::Texture2D flappyTexture;
-raylib::Texture2D tubeTexture;
+ObjectPool<TubePair, MAX_LIVE_TUBES> tubes;
+int tubesSpawned = 0;
+float nextTubeX = 0.0f; // where the next pair enters, scrolls along with the live tubes
+
+Random rng;
+InputSession session{TICKS_PER_SECOND};
+FixedStepLoop loop{TICKS_PER_SECOND};
+
+raylib::ImageLoader imageLoader;
+raylib::TextureUploader uploader{imageLoader};
+raylib::AssetCache assets;
+raylib::AssetCache::Handle<raylib::Texture2D> backgroundTexture;
+raylib::TextureAtlas atlas;
+raylib::AssetCache::Handle<raylib::Texture2D> atlasTexture;
+raylib::SpriteBatch sprites{2 * MAX_LIVE_TUBES + 1};
 
 void initFlappyPosition();
 bool touchBorder(raylib::Vector2);
+void spawnTubes();
 void InitGame();
 void UpdateGame();
 void tuneAlpha();
 void announceGame();
-void DrawGame();
+void DrawGame(float blend);
 void UpdateDrawFrame();
 
 bool touchBorder(raylib::Vector2 center)
@@ -76,91 +96,116 @@ void initFlappyPosition()
 {
   flappy.position.x = 80;
   flappy.position.y = (float)(SCREEN_HEIGHT / 2 - FLAPPY_RADIUS);
+  flappy.previousPosition = flappy.position;
 }
 
-void InitGame()
+// Bring in tube pairs as they are about to scroll into view, up to MAX_TUBES per run
+void spawnTubes()
 {
-  backgroundTexture = ::LoadTexture("../assets/flappy_bg.png");
-  flappyTexture = ::LoadTexture("../assets/flappy_bird.png");
-  tubeTexture = ::LoadTexture("../assets/flappy_tube.png");
+  while (tubesSpawned < MAX_TUBES && nextTubeX <= SCREEN_WIDTH)
+  {
+    int slot = tubes.Acquire();
+    if (slot < 0)
+    {
+      break;
+    }
 
-  initFlappyPosition();
-  Y_speed = 0.0;
-  score = 0;
+    float y = -rng.GetRandomValue(0, 120);
+    float height = rng.GetRandomValue(220, 245);
+    tubes[slot] = TubePair{raylib::Rectangle{nextTubeX, y, TUBES_WIDTH, height},
+                           raylib::Rectangle{nextTubeX, 600 + y - 255, TUBES_WIDTH, height}, false, nextTubeX};
 
-  for (int i = 0; i < MAX_TUBES; ++i)
-  {
-    tubesPos[i].SetX(400 + 280 * i);
-    tubesPos[i].SetY(-GetRandomValue(0, 120));
+    nextTubeX += TUBE_SPACING;
+    ++tubesSpawned;
   }
+}
 
-  for (int i = 0; i < MAX_TUBES * 2; i += 2)
-  {
-    tubes[i].rec.SetX(tubesPos[i / 2].GetX());
-    tubes[i].rec.SetY(tubesPos[i / 2].GetY());
-    tubes[i].rec.SetWidth(TUBES_WIDTH);
-    tubes[i].rec.SetHeight(GetRandomValue(220, 245));
+void InitGame()
+{
+  // Both are still held from the last game on a restart, so the cache hands them back without loading anything
+  backgroundTexture = assets.LoadTextureAsync("../assets/flappy_bg.png", uploader);
+  atlasTexture = assets.LoadTexture("flappy_bird atlas", []() {
+    atlas.Pack({{"flappy", "../assets/flappy_bird.png"}, {"tube", "../assets/flappy_tube.png"}},
+                imageLoader);
+    return ::LoadTextureFromImage(atlas.GetImage());
+  });
 
-    tubes[i + 1].rec.SetX(tubesPos[i / 2].GetX());
-    tubes[i + 1].rec.SetY(600 + tubesPos[i / 2].y - 255);
-    tubes[i + 1].rec.SetWidth(TUBES_WIDTH);
-    tubes[i + 1].rec.SetHeight(tubes[i].rec.GetHeight());
+  initFlappyPosition();
+  Y_speed = 0.0;
+  score = 0;
 
-    tubes[i / 2].active = true;
-  }
+  tubes.Clear();
+  tubesSpawned = 0;
+  nextTubeX = 400;
+  spawnTubes();
 }
 
-// Update game variables for a frame
+// Update game variables for one tick
 void UpdateGame()
 {
+  TickInput input = session.NextTick();
+
+  flappy.previousPosition = flappy.position;
+  tubes.ForEachLive([](int i) { tubes[i].previousX = tubes[i].top.x; });
+
   tuneAlpha();
   if (!isGameOver)
   {
-    if (::IsKeyPressed(KEY_P))
+    if (input.Pressed(INPUT_PAUSE))
     {
       isPaused = !isPaused;
     }
 
     if (!isPaused)
     {
-      for (int i = 0; i < MAX_TUBES; ++i)
-      {
-        tubesPos[i].x -= TUBE_SPEED;
-      }
+      tubes.ForEachLive([](int i) {
+        tubes[i].top.x -= TUBE_SPEED;
+        tubes[i].bottom.x -= TUBE_SPEED;
 
-      for (int i = 0; i < MAX_TUBES * 2; i += 2)
-      {
-        tubes[i].rec.x = tubesPos[i / 2].x;
-        tubes[i + 1].rec.x = tubesPos[i / 2].x;
-      }
+        // The tube sprite is a little wider than its hitbox, so wait until it is fully off screen
+        if (tubes[i].top.x + TUBES_WIDTH * 2 < 0)
+        {
+          tubes.Release(i);
+        }
+      });
+
+      nextTubeX -= TUBE_SPEED;
+      spawnTubes();
 
       // Gravitational acceleration
       // Reference: https://scratch.mit.edu/projects/502812449/editor/
       flappy.position.y += Y_speed;
       Y_speed += GRAVITATIONAL_ACCELRATION;
-      if (::IsKeyDown(::KEY_SPACE) && !isGameOver)
+      if (input.Held(INPUT_SPACE) && !isGameOver)
       {
         Y_speed = BOUNCE_FORCE;
       }
 
       // Check Collisions
-      for (int i = 0; i < MAX_TUBES * 2; i++)
+      if (touchBorder(flappy.position))
       {
-        if (CheckCollisionCircleRec(flappy.position, flappy.radius, tubes[i].rec) || touchBorder(flappy.position))
+        isGameOver = true;
+        isPaused = false;
+      }
+
+      tubes.ForEachLive([](int i) {
+        TubePair &tube = tubes[i];
+        if (CheckCollisionCircleRec(flappy.position, flappy.radius, tube.top) ||
+            CheckCollisionCircleRec(flappy.position, flappy.radius, tube.bottom))
         {
           isGameOver = true;
           isPaused = false;
         }
-        else if ((tubesPos[i / 2].x < flappy.position.x) && tubes[i / 2].active && !isGameOver)
+        else if ((tube.top.x < flappy.position.x) && !tube.scored && !isGameOver)
         {
           score += 100;
-          tubes[i / 2].active = false;
+          tube.scored = true;
           hiScore = std::max(hiScore, score);
         }
-      }
+      });
     }
   }
-  else if (::IsKeyPressed(::KEY_ENTER))
+  else if (input.Pressed(INPUT_ENTER))
   {
     InitGame();
     isGameOver = false;
@@ -190,40 +235,33 @@ void announceGame()
              Fade(::WHITE, alpha));
 }
 
-// Draw game for one frame
-void DrawGame()
+// Draw game for one frame, blend is how far we are between the last tick and the next one
+void DrawGame(float blend)
 {
   ::BeginDrawing();
   ::ClearBackground(::RAYWHITE);
 
   if (!isGameOver)
   {
-    backgroundTexture.Draw(raylib::Vector2{0, 0}, 0.0f, 0.5f, ::WHITE);
+    backgroundTexture->Draw(raylib::Vector2{0, 0}, 0.0f, 0.5f, ::WHITE);
 
     // flappy.position.DrawCircle(flappy.radius, flappy.color);
-    raylib::Vector2 adjustedFlappyPosition{flappy.position.GetX() - flappy.radius - 2,
-                                           flappy.position.GetY() - flappy.radius - 6};
-
-    flappyTexture.Draw(adjustedFlappyPosition, 0.0f, 0.4f, ::WHITE);
-
-    // Draw tubes
-    for (int i = 0; i < MAX_TUBES; ++i)
-    {
-      // ::DrawRectangle(tubes[i * 2].rec.x, tubes[i * 2].rec.y, tubes[i * 2].rec.width, tubes[i * 2].rec.height,
-      //                          ::MAROON);
-      // ::DrawRectangle(tubes[i * 2 + 1].rec.x, tubes[i * 2 + 1].rec.y, tubes[i * 2 + 1].rec.width,
-      //                          tubes[i * 2 + 1].rec.height, ::MAROON);
-      // ::DrawRectangleLinesEx(
-      //     raylib::Rectangle{tubes[i * 2].rec.x, tubes[i * 2].rec.y, tubes[i * 2].rec.width, tubes[i * 2].rec.height},
-      //     2, ::BLACK);
-      // ::DrawRectangleLinesEx(raylib::Rectangle{tubes[i * 2 + 1].rec.x, tubes[i * 2 + 1].rec.y,
-      //                                          tubes[i * 2 + 1].rec.width, tubes[i * 2 + 1].rec.height},
-      //                        2, ::BLACK);
-
-      tubeTexture.Draw(raylib::Vector2{tubes[i * 2].rec.x + TUBES_WIDTH, tubes[i * 2].rec.y + tubes[i * 2].rec.height},
-                       180.0f, 0.7f, ::PINK);
-      tubeTexture.Draw(raylib::Vector2{tubes[i * 2 + 1].rec.x, tubes[i * 2 + 1].rec.y}, 0.0f, 0.7f, ::PINK);
-    }
+    float flappyX = LerpFloat(flappy.previousPosition.x, flappy.position.x, blend);
+    float flappyY = LerpFloat(flappy.previousPosition.y, flappy.position.y, blend);
+    raylib::Vector2 adjustedFlappyPosition{flappyX - flappy.radius - 2, flappyY - flappy.radius - 6};
+
+    sprites.Add(*atlasTexture, atlas.Get("flappy"), adjustedFlappyPosition, 0.0f, 0.4f, ::WHITE);
+
+    // Draw tubes, in the same batch as flappy
+    ::Rectangle tubeSprite = atlas.Get("tube");
+    tubes.ForEachLive([blend, tubeSprite](int i) {
+      const TubePair &tube = tubes[i];
+      float x = LerpFloat(tube.previousX, tube.top.x, blend);
+      sprites.Add(*atlasTexture, tubeSprite, raylib::Vector2{x + TUBES_WIDTH, tube.top.y + tube.top.height}, 180.0f,
+                  0.7f, ::PINK);
+      sprites.Add(*atlasTexture, tubeSprite, raylib::Vector2{x, tube.bottom.y}, 0.0f, 0.7f, ::PINK);
+    });
+    sprites.Flush();
 
     ::DrawText(TextFormat("%04i", score), 20, 20, 40, ::WHITE);
     ::DrawText(TextFormat("HI-SCORE: %04i", hiScore), 20, 70, 20, ::WHITE);
@@ -236,7 +274,7 @@ void DrawGame()
   }
   else
   {
-    backgroundTexture.Draw(raylib::Vector2{0, 0}, 0.0f, 0.5f, ::GRAY);
+    backgroundTexture->Draw(raylib::Vector2{0, 0}, 0.0f, 0.5f, ::GRAY);
 
     ::DrawText("PRESS [ENTER] TO PLAY AGAIN", GetScreenWidth() / 2 - MeasureText("PRESS [ENTER] TO PLAY AGAIN", 25) / 2,
                GetScreenHeight() / 2 - 50, 25, ::WHITE);
@@ -249,22 +287,34 @@ void DrawGame()
 
 void UpdateDrawFrame()
 {
-  UpdateGame();
-  DrawGame();
+  session.Poll();
+  uploader.Update();
+  float blend = loop.Advance(::GetFrameTime(), UpdateGame);
+  DrawGame(blend);
 }
 
 } // namespace
 
-int main()
+int main(int argc, char **argv)
 {
+  session.Open(argc, argv);
   raylib::Window window{SCREEN_WIDTH, SCREEN_HEIGHT, "Sample game: Flappy Bird"};
+  session.SeedRandom(rng);
   InitGame();
   ::SetTargetFPS(120);
 
+  if (session.IsReplay())
+  {
+    session.Replay(UpdateGame);
+    std::printf("final score %d, hi-score %d\n", score, hiScore);
+    return 0;
+  }
+
   while (!window.ShouldClose())
   {
     UpdateDrawFrame();
   }
 
+  session.Finish();
   return 0;
 }
@@ -1,7 +1,9 @@
 #include "../include/raylib-cpp.hpp"
+#include "random.hpp"
 #include "raylib.h"
 
 #include <array>
+#include <ctime>
 
 // Compile command:  g++ fps.cpp -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
 
@@ -47,15 +49,17 @@ int main()
                           raylib::Vector3(0.0f, 1.0f, 0.0f), 60.0f, CAMERA_PERSPECTIVE);
 
   // Generates some random columns
+  Random rng{(uint64_t)std::time(nullptr)};
   std::array<float, MAX_COLUMNS> heights;
   std::array<raylib::Vector3, MAX_COLUMNS> positions;
   std::array<raylib::Color, MAX_COLUMNS> colors;
 
   for (int i = 0; i < MAX_COLUMNS; ++i)
   {
-    heights[i] = (float)::GetRandomValue(1, 3); // int to float
-    positions[i] = raylib::Vector3(GetRandomValue(-15, 15), heights[i] / 2, GetRandomValue(-15, 15));
-    colors[i] = raylib::Color(GetRandomValue(30, 50), GetRandomValue(15, 25), GetRandomValue(5, 25));
+    heights[i] = (float)rng.GetRandomValue(1, 3); // int to float
+    positions[i] = raylib::Vector3(rng.GetRandomValue(-15, 15), heights[i] / 2, rng.GetRandomValue(-15, 15));
+    colors[i] =
+        raylib::Color(rng.GetRandomValue(30, 50), rng.GetRandomValue(15, 25), rng.GetRandomValue(5, 25));
   }
 
   camera.SetMode(CAMERA_FIRST_PERSON);
@@ -0,0 +1,131 @@
+#ifndef GAME_LOOP_HPP_
+#define GAME_LOOP_HPP_
+
+#include "../include/raylib-cpp.hpp"
+#include "raylib.h"
+
+#include <cmath>
+#include <cstdint>
+
+// Keys and buttons the sample games read, one bit each in TickInput
+enum InputKey
+{
+  INPUT_LEFT,
+  INPUT_RIGHT,
+  INPUT_UP,
+  INPUT_DOWN,
+  INPUT_SPACE,
+  INPUT_PAUSE,
+  INPUT_ENTER,
+  INPUT_MOUSE_LEFT,
+  INPUT_KEY_COUNT
+};
+
+// Input as seen by one simulation tick
+struct TickInput
+{
+  uint32_t held = 0;    // keys down when the frame was polled
+  uint32_t pressed = 0; // keys that went down since the previous tick
+  int mouseX = 0;
+
+  bool Held(InputKey key) const
+  {
+    return (held >> key) & 1;
+  }
+
+  bool Pressed(InputKey key) const
+  {
+    return (pressed >> key) & 1;
+  }
+};
+
+// Polls the keyboard and mouse once per rendered frame and hands the result out per tick. Presses are latched until
+// a tick consumes them, so a press in a frame that runs no tick is not lost and a frame that runs several ticks
+// reports it to the first one only.
+class InputSampler
+{
+public:
+  void Poll()
+  {
+    static const int keys[INPUT_KEY_COUNT - 1] = {::KEY_LEFT,  ::KEY_RIGHT, ::KEY_UP,   ::KEY_DOWN,
+                                                  ::KEY_SPACE, ::KEY_P,     ::KEY_ENTER};
+
+    latched.held = 0;
+    for (int i = 0; i < INPUT_KEY_COUNT - 1; ++i)
+    {
+      latched.held |= (uint32_t)::IsKeyDown(keys[i]) << i;
+      latched.pressed |= (uint32_t)::IsKeyPressed(keys[i]) << i;
+    }
+    latched.held |= (uint32_t)::IsMouseButtonDown(::MOUSE_LEFT_BUTTON) << INPUT_MOUSE_LEFT;
+    latched.pressed |= (uint32_t)::IsMouseButtonPressed(::MOUSE_LEFT_BUTTON) << INPUT_MOUSE_LEFT;
+    latched.mouseX = ::GetMouseX();
+  }
+
+  TickInput Consume()
+  {
+    TickInput input = latched;
+    latched.pressed = 0;
+    return input;
+  }
+
+private:
+  TickInput latched;
+};
+
+// Runs game logic at a fixed tick rate regardless of how fast frames are rendered.
+//
+// Each frame adds its real duration to an accumulator and runs as many whole ticks as fit. The remainder, as a
+// fraction of a tick, is returned so the renderer can blend between the previous and current tick's state. When a
+// frame falls too far behind, the backlog beyond maxTicksPerFrame is dropped rather than chased.
+class FixedStepLoop
+{
+public:
+  explicit FixedStepLoop(double ticksPerSecond, int maxTicksPerFrame = 8)
+      : tickSeconds{1.0 / ticksPerSecond}, maxTicksPerFrame{maxTicksPerFrame}
+  {
+  }
+
+  double GetTickSeconds() const
+  {
+    return tickSeconds;
+  }
+
+  long long GetTickCount() const
+  {
+    return tickCount;
+  }
+
+  // Run tick() for every whole tick that fits in the accumulated time, returns the blend factor in [0, 1)
+  template <typename Tick> float Advance(double frameSeconds, Tick &&tick)
+  {
+    accumulator += frameSeconds;
+
+    for (int ticks = 0; accumulator >= tickSeconds; ++ticks)
+    {
+      if (ticks == maxTicksPerFrame)
+      {
+        accumulator = std::fmod(accumulator, tickSeconds);
+        break;
+      }
+
+      tick();
+      accumulator -= tickSeconds;
+      ++tickCount;
+    }
+
+    return (float)(accumulator / tickSeconds);
+  }
+
+private:
+  double tickSeconds;
+  int maxTicksPerFrame;
+  double accumulator = 0.0;
+  long long tickCount = 0;
+};
+
+inline float LerpFloat(float from, float to, float blend)
+{
+  return from + (to - from) * blend;
+}
+
+#endif
@@ -0,0 +1,277 @@
+#ifndef INPUT_LOG_HPP_
+#define INPUT_LOG_HPP_
+
+#include "game_loop.hpp"
+#include "random.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+// Every TickInput a session fed to the game, plus the seed of the game's Random, so the session can be replayed tick
+// for tick.
+//
+// On disk the log is a 16-byte header followed by run-length encoded ticks. Input rarely changes from one tick to
+// the next, so each run stores how many ticks it lasts as a varint, the held and pressed key bytes, and the change in
+// mouse X as a zigzag varint. A minute of play at 120 ticks per second typically fits in a few kilobytes.
+//
+//   header: "RLIR" | version u16 | ticksPerSecond u16 | seed u32 | tickCount u32   (little endian)
+//   run:    length varint | held u8 | pressed u8 | mouseX delta zigzag varint
+class InputLog
+{
+public:
+  uint32_t seed = 0;
+  int ticksPerSecond = 0;
+  std::vector<TickInput> ticks;
+
+  bool Save(const std::string &fileName) const
+  {
+    std::vector<uint8_t> bytes{'R', 'L', 'I', 'R'};
+    putFixed(bytes, VERSION, 2);
+    putFixed(bytes, (uint32_t)ticksPerSecond, 2);
+    putFixed(bytes, seed, 4);
+    putFixed(bytes, (uint32_t)ticks.size(), 4);
+
+    int lastMouseX = 0;
+    for (size_t start = 0; start < ticks.size();)
+    {
+      const TickInput &run = ticks[start];
+      size_t end = start + 1;
+      while (end < ticks.size() && sameInput(ticks[end], run))
+      {
+        ++end;
+      }
+
+      putVarint(bytes, (uint32_t)(end - start));
+      bytes.push_back((uint8_t)run.held);
+      bytes.push_back((uint8_t)run.pressed);
+      int32_t delta = run.mouseX - lastMouseX;
+      putVarint(bytes, ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31));
+      lastMouseX = run.mouseX;
+
+      start = end;
+    }
+
+    FILE *file = std::fopen(fileName.c_str(), "wb");
+    if (file == nullptr)
+    {
+      return false;
+    }
+    bool written = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+    return std::fclose(file) == 0 && written;
+  }
+
+  // Returns false when the file can't be read or isn't a complete log of this version
+  bool Load(const std::string &fileName)
+  {
+    FILE *file = std::fopen(fileName.c_str(), "rb");
+    if (file == nullptr)
+    {
+      return false;
+    }
+    std::vector<uint8_t> bytes;
+    uint8_t buffer[4096];
+    for (size_t count; (count = std::fread(buffer, 1, sizeof(buffer), file)) > 0;)
+    {
+      bytes.insert(bytes.end(), buffer, buffer + count);
+    }
+    std::fclose(file);
+
+    if (bytes.size() < HEADER_SIZE || std::memcmp(bytes.data(), "RLIR", 4) != 0 || getFixed(bytes, 4, 2) != VERSION)
+    {
+      return false;
+    }
+    ticksPerSecond = (int)getFixed(bytes, 6, 2);
+    seed = getFixed(bytes, 8, 4);
+    uint32_t tickCount = getFixed(bytes, 12, 4);
+
+    ticks.clear();
+    ticks.reserve(tickCount);
+    size_t offset = HEADER_SIZE;
+    int mouseX = 0;
+    while (ticks.size() < tickCount)
+    {
+      uint32_t length = 0, zigzag = 0;
+      if (!getVarint(bytes, offset, length) || offset + 2 > bytes.size())
+      {
+        return false;
+      }
+      TickInput run;
+      run.held = bytes[offset++];
+      run.pressed = bytes[offset++];
+      if (!getVarint(bytes, offset, zigzag) || length == 0 || length > tickCount - ticks.size())
+      {
+        return false;
+      }
+      mouseX += (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
+      run.mouseX = mouseX;
+      ticks.insert(ticks.end(), length, run);
+    }
+    return true;
+  }
+
+private:
+  static const uint32_t VERSION = 1;
+  static const size_t HEADER_SIZE = 16;
+
+  static bool sameInput(const TickInput &a, const TickInput &b)
+  {
+    return a.held == b.held && a.pressed == b.pressed && a.mouseX == b.mouseX;
+  }
+
+  static void putFixed(std::vector<uint8_t> &bytes, uint32_t value, int size)
+  {
+    for (int i = 0; i < size; ++i)
+    {
+      bytes.push_back((uint8_t)(value >> (8 * i)));
+    }
+  }
+
+  static uint32_t getFixed(const std::vector<uint8_t> &bytes, size_t offset, int size)
+  {
+    uint32_t value = 0;
+    for (int i = 0; i < size; ++i)
+    {
+      value |= (uint32_t)bytes[offset + i] << (8 * i);
+    }
+    return value;
+  }
+
+  static void putVarint(std::vector<uint8_t> &bytes, uint32_t value)
+  {
+    for (; value >= 0x80; value >>= 7)
+    {
+      bytes.push_back((uint8_t)(value | 0x80));
+    }
+    bytes.push_back((uint8_t)value);
+  }
+
+  static bool getVarint(const std::vector<uint8_t> &bytes, size_t &offset, uint32_t &value)
+  {
+    value = 0;
+    for (int shift = 0; shift < 35 && offset < bytes.size(); shift += 7)
+    {
+      uint8_t byte = bytes[offset++];
+      value |= (uint32_t)(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+// Where a game's ticks get their input: the live InputSampler, optionally recorded to a log with --record <file>, or
+// a log played back with --replay <file>.
+//
+// A replay opens a hidden window, because the games load their textures through GL, and runs every logged tick
+// back to back without drawing or frame pacing, then reports how long that took.
+class InputSession
+{
+public:
+  explicit InputSession(int ticksPerSecond)
+  {
+    log.ticksPerSecond = ticksPerSecond;
+    log.seed = (uint32_t)std::time(nullptr);
+  }
+
+  // Pick up --record/--replay from the command line, before the window is created
+  void Open(int argc, char **argv)
+  {
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+      if (std::strcmp(argv[i], "--record") == 0)
+      {
+        recordFile = argv[i + 1];
+      }
+      else if (std::strcmp(argv[i], "--replay") == 0)
+      {
+        replayFile = argv[i + 1];
+      }
+    }
+
+    if (IsReplay())
+    {
+      if (!log.Load(replayFile))
+      {
+        std::fprintf(stderr, "Could not read input log %s\n", replayFile.c_str());
+        std::exit(EXIT_FAILURE);
+      }
+      ::SetConfigFlags(::FLAG_WINDOW_HIDDEN);
+    }
+  }
+
+  bool IsReplay() const
+  {
+    return !replayFile.empty();
+  }
+
+  // Seed the game's random numbers for this session, before the game is initialized
+  void SeedRandom(Random &rng) const
+  {
+    rng.Seed(log.seed);
+  }
+
+  // Sample the devices, once per rendered frame
+  void Poll()
+  {
+    if (!IsReplay())
+    {
+      sampler.Poll();
+    }
+  }
+
+  // Input for the next tick
+  TickInput NextTick()
+  {
+    if (IsReplay())
+    {
+      return cursor < log.ticks.size() ? log.ticks[cursor++] : TickInput{};
+    }
+
+    TickInput input = sampler.Consume();
+    if (!recordFile.empty())
+    {
+      log.ticks.push_back(input);
+    }
+    return input;
+  }
+
+  // Run tick() until the log is used up, tick() is expected to call NextTick() exactly once
+  template <typename Tick> void Replay(Tick &&tick)
+  {
+    auto start = std::chrono::steady_clock::now();
+    while (cursor < log.ticks.size())
+    {
+      tick();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("replayed %zu ticks (%.1f s of play) in %.3f s, %.0f ticks/s\n", log.ticks.size(),
+                (double)log.ticks.size() / log.ticksPerSecond, seconds, log.ticks.size() / seconds);
+  }
+
+  // Write the recorded log, if recording
+  void Finish() const
+  {
+    if (!recordFile.empty() && !log.Save(recordFile))
+    {
+      std::fprintf(stderr, "Could not write input log %s\n", recordFile.c_str());
+    }
+  }
+
+private:
+  InputSampler sampler;
+  InputLog log;
+  std::string recordFile;
+  std::string replayFile;
+  size_t cursor = 0;
+};
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef OBJECT_POOL_HPP_
+#define OBJECT_POOL_HPP_
+
+#include <array>
+#include <vector>
+
+// Hands out slot indices in [0, capacity) with O(1) acquire and release.
+//
+// A single permutation array holds the live slots packed at the front and the free slots behind them, so iterating
+// live objects never touches a dead one and releasing is a swap with the last live entry. ForEachLive() walks the
+// live slots back to front, which lets the visitor release the slot it is handed without skipping anything.
+class SlotAllocator
+{
+public:
+  explicit SlotAllocator(int capacity) : slots(capacity), positions(capacity)
+  {
+    Clear();
+  }
+
+  int Capacity() const
+  {
+    return (int)slots.size();
+  }
+
+  int Size() const
+  {
+    return size;
+  }
+
+  // One past the highest slot handed out since the last Clear(), bounds the range array passes need to cover
+  int HighWater() const
+  {
+    return highWater;
+  }
+
+  bool IsLive(int slot) const
+  {
+    return positions[slot] < size;
+  }
+
+  // Returns a free slot, or -1 when every slot is live
+  int Acquire()
+  {
+    if (size == Capacity())
+    {
+      return -1;
+    }
+    int slot = slots[size++];
+    highWater = slot + 1 > highWater ? slot + 1 : highWater;
+    return slot;
+  }
+
+  void Release(int slot)
+  {
+    int position = positions[slot];
+    if (position >= size)
+    {
+      return;
+    }
+
+    int last = slots[--size];
+    slots[position] = last;
+    positions[last] = position;
+    slots[size] = slot;
+    positions[slot] = size;
+  }
+
+  void Clear()
+  {
+    for (int i = 0; i < Capacity(); ++i)
+    {
+      slots[i] = i;
+      positions[i] = i;
+    }
+    size = 0;
+    highWater = 0;
+  }
+
+  template <typename Visitor> void ForEachLive(Visitor &&visit) const
+  {
+    for (int i = size - 1; i >= 0; --i)
+    {
+      visit(slots[i]);
+    }
+  }
+
+private:
+  std::vector<int> slots;     // live slots in [0, size), free slots after
+  std::vector<int> positions; // slot -> index into slots
+  int size = 0;
+  int highWater = 0;
+};
+
+// Fixed-capacity pool of T built on SlotAllocator. Objects stay in place for their whole life, so a slot index is a
+// stable handle until it is released.
+template <typename T, int Capacity> class ObjectPool
+{
+public:
+  ObjectPool() : allocator{Capacity}
+  {
+  }
+
+  // Returns the slot of a fresh object, or -1 when the pool is full. The object keeps whatever it held before, so
+  // callers assign it right away.
+  int Acquire()
+  {
+    return allocator.Acquire();
+  }
+
+  void Release(int slot)
+  {
+    allocator.Release(slot);
+  }
+
+  void Clear()
+  {
+    allocator.Clear();
+  }
+
+  bool IsLive(int slot) const
+  {
+    return allocator.IsLive(slot);
+  }
+
+  int Size() const
+  {
+    return allocator.Size();
+  }
+
+  T &operator[](int slot)
+  {
+    return objects[slot];
+  }
+
+  const T &operator[](int slot) const
+  {
+    return objects[slot];
+  }
+
+  // Call visit(slot) for every live object; the visitor may release the slot it is given
+  template <typename Visitor> void ForEachLive(Visitor &&visit) const
+  {
+    allocator.ForEachLive(visit);
+  }
+
+private:
+  std::array<T, Capacity> objects;
+  SlotAllocator allocator;
+};
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef OCCUPANCY_GRID_HPP_
+#define OCCUPANCY_GRID_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// One bit per cell of a columns x rows board, set while something occupies the cell.
+//
+// Test() is a single bit lookup. The grid can also hand out the k-th free cell in row-major order: free cells are
+// counted per 64-cell word in a Fenwick tree, so SelectFree() walks log2(words) tree levels and then a single word,
+// and a Set() or Clear() that flips a bit updates log2(words) counters. Picking a uniformly random free cell is then
+// one random number and one select, however crowded the board is.
+class OccupancyGrid
+{
+public:
+  OccupancyGrid(int columns, int rows)
+      : columns{columns}, rows{rows}, words(((size_t)columns * rows + 63) / 64), tree(words.size() + 1)
+  {
+    topBit = 1;
+    while (topBit * 2 <= words.size())
+    {
+      topBit *= 2;
+    }
+    Reset();
+  }
+
+  int Columns() const
+  {
+    return columns;
+  }
+
+  int Rows() const
+  {
+    return rows;
+  }
+
+  int CellCount() const
+  {
+    return columns * rows;
+  }
+
+  int FreeCount() const
+  {
+    return freeCount;
+  }
+
+  bool Contains(int column, int row) const
+  {
+    return column >= 0 && row >= 0 && column < columns && row < rows;
+  }
+
+  int CellOf(int column, int row) const
+  {
+    return row * columns + column;
+  }
+
+  bool Test(int cell) const
+  {
+    return (words[cell >> 6] >> (cell & 63)) & 1;
+  }
+
+  void Set(int cell)
+  {
+    uint64_t bit = uint64_t{1} << (cell & 63);
+    if ((words[cell >> 6] & bit) == 0)
+    {
+      words[cell >> 6] |= bit;
+      addFree(cell >> 6, -1);
+    }
+  }
+
+  void Clear(int cell)
+  {
+    uint64_t bit = uint64_t{1} << (cell & 63);
+    if ((words[cell >> 6] & bit) != 0)
+    {
+      words[cell >> 6] &= ~bit;
+      addFree(cell >> 6, 1);
+    }
+  }
+
+  // Mark every cell free
+  void Reset()
+  {
+    std::fill(words.begin(), words.end(), 0);
+    int tail = CellCount() & 63;
+    if (tail != 0)
+    {
+      words.back() = ~uint64_t{0} << tail; // cells past the board stay occupied
+    }
+
+    // Build the tree in O(words): each node passes its sum on to its parent
+    for (size_t i = 1; i < tree.size(); ++i)
+    {
+      tree[i] = 64 - __builtin_popcountll(words[i - 1]);
+    }
+    for (size_t i = 1; i < tree.size(); ++i)
+    {
+      size_t parent = i + (i & (~i + 1));
+      if (parent < tree.size())
+      {
+        tree[parent] += tree[i];
+      }
+    }
+    freeCount = CellCount();
+  }
+
+  // The k-th free cell in row-major order, k in [0, FreeCount())
+  int SelectFree(int k) const
+  {
+    // Descend the tree to the word holding the k-th free cell
+    size_t word = 0;
+    for (size_t step = topBit; step != 0; step >>= 1)
+    {
+      if (word + step < tree.size() && tree[word + step] <= k)
+      {
+        word += step;
+        k -= tree[word];
+      }
+    }
+
+    uint64_t freeBits = ~words[word];
+    for (; k > 0; --k)
+    {
+      freeBits &= freeBits - 1;
+    }
+    return (int)(word * 64) + __builtin_ctzll(freeBits);
+  }
+
+private:
+  int columns;
+  int rows;
+  std::vector<uint64_t> words;
+  std::vector<int> tree; // Fenwick tree of free cells per word, 1-based
+  size_t topBit = 1;
+  int freeCount = 0;
+
+  void addFree(size_t word, int delta)
+  {
+    for (size_t i = word + 1; i < tree.size(); i += i & (~i + 1))
+    {
+      tree[i] += delta;
+    }
+    freeCount += delta;
+  }
+};
+
+#endif
@@ -0,0 +1,185 @@
+#ifndef RANDOM_HPP_
+#define RANDOM_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// Seedable pseudo random numbers owned by whoever needs them, in place of raylib's process-wide ::GetRandomValue.
+//
+// Single values come from one xoshiro128** stream. Fill() draws from eight more xoshiro128** streams stepped side by
+// side, two SSE2 or NEON registers per state word, so batch spawns get their numbers several at a time. Both depend
+// on the seed alone: the SIMD and scalar paths produce the same sequence on every platform.
+class Random
+{
+public:
+  static const int LANES = 8;
+
+  explicit Random(uint64_t seed = 0)
+  {
+    Seed(seed);
+  }
+
+  void Seed(uint64_t seed)
+  {
+    uint64_t mix = seed;
+    for (uint32_t &word : state)
+    {
+      word = (uint32_t)(splitMix(mix) >> 32);
+    }
+    for (auto &word : lanes)
+    {
+      for (uint32_t &lane : word)
+      {
+        lane = (uint32_t)(splitMix(mix) >> 32);
+      }
+    }
+  }
+
+  uint32_t Next()
+  {
+    uint32_t result = rotl(state[1] * 5, 7) * 9;
+    uint32_t t = state[1] << 9;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 11);
+    return result;
+  }
+
+  // Same contract as ::GetRandomValue: a value in [min, max], bounds may come in either order
+  int GetRandomValue(int min, int max)
+  {
+    if (min > max)
+    {
+      int swap = min;
+      min = max;
+      max = swap;
+    }
+    return mapToRange(Next(), min, (uint32_t)((int64_t)max - min + 1));
+  }
+
+  // Write count values in [min, max] to out, as GetRandomValue() would but drawn from the batch streams
+  void Fill(int *out, size_t count, int min, int max)
+  {
+    if (min > max)
+    {
+      int swap = min;
+      min = max;
+      max = swap;
+    }
+    uint32_t range = (uint32_t)((int64_t)max - min + 1);
+
+    alignas(16) uint32_t block[LANES];
+    for (size_t i = 0; i < count; i += LANES)
+    {
+      nextBlock(block);
+      size_t n = count - i < (size_t)LANES ? count - i : (size_t)LANES;
+      for (size_t k = 0; k < n; ++k)
+      {
+        out[i + k] = mapToRange(block[k], min, range);
+      }
+    }
+  }
+
+private:
+  uint32_t state[4];
+  alignas(16) uint32_t lanes[4][LANES]; // state word, then stream
+
+  static uint64_t splitMix(uint64_t &x)
+  {
+    uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+  }
+
+  static uint32_t rotl(uint32_t x, int k)
+  {
+    return (x << k) | (x >> (32 - k));
+  }
+
+  // Multiply-shift range reduction, a range of 0 stands for the full 2^32
+  static int mapToRange(uint32_t bits, int min, uint32_t range)
+  {
+    uint32_t offset = range == 0 ? bits : (uint32_t)(((uint64_t)bits * range) >> 32);
+    return (int)((int64_t)min + offset);
+  }
+
+  // One xoshiro128** step of every batch stream
+  void nextBlock(uint32_t *out)
+  {
+#if defined(__SSE2__)
+    for (int half = 0; half < LANES; half += 4)
+    {
+      __m128i s0 = _mm_load_si128((const __m128i *)&lanes[0][half]);
+      __m128i s1 = _mm_load_si128((const __m128i *)&lanes[1][half]);
+      __m128i s2 = _mm_load_si128((const __m128i *)&lanes[2][half]);
+      __m128i s3 = _mm_load_si128((const __m128i *)&lanes[3][half]);
+
+      __m128i times5 = _mm_add_epi32(_mm_slli_epi32(s1, 2), s1);
+      __m128i rotated = _mm_or_si128(_mm_slli_epi32(times5, 7), _mm_srli_epi32(times5, 25));
+      _mm_store_si128((__m128i *)(out + half), _mm_add_epi32(_mm_slli_epi32(rotated, 3), rotated));
+
+      __m128i t = _mm_slli_epi32(s1, 9);
+      s2 = _mm_xor_si128(s2, s0);
+      s3 = _mm_xor_si128(s3, s1);
+      s1 = _mm_xor_si128(s1, s2);
+      s0 = _mm_xor_si128(s0, s3);
+      s2 = _mm_xor_si128(s2, t);
+      s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+
+      _mm_store_si128((__m128i *)&lanes[0][half], s0);
+      _mm_store_si128((__m128i *)&lanes[1][half], s1);
+      _mm_store_si128((__m128i *)&lanes[2][half], s2);
+      _mm_store_si128((__m128i *)&lanes[3][half], s3);
+    }
+#elif defined(__ARM_NEON)
+    for (int half = 0; half < LANES; half += 4)
+    {
+      uint32x4_t s0 = vld1q_u32(&lanes[0][half]);
+      uint32x4_t s1 = vld1q_u32(&lanes[1][half]);
+      uint32x4_t s2 = vld1q_u32(&lanes[2][half]);
+      uint32x4_t s3 = vld1q_u32(&lanes[3][half]);
+
+      uint32x4_t times5 = vmulq_n_u32(s1, 5);
+      uint32x4_t rotated = vorrq_u32(vshlq_n_u32(times5, 7), vshrq_n_u32(times5, 25));
+      vst1q_u32(out + half, vmulq_n_u32(rotated, 9));
+
+      uint32x4_t t = vshlq_n_u32(s1, 9);
+      s2 = veorq_u32(s2, s0);
+      s3 = veorq_u32(s3, s1);
+      s1 = veorq_u32(s1, s2);
+      s0 = veorq_u32(s0, s3);
+      s2 = veorq_u32(s2, t);
+      s3 = vorrq_u32(vshlq_n_u32(s3, 11), vshrq_n_u32(s3, 21));
+
+      vst1q_u32(&lanes[0][half], s0);
+      vst1q_u32(&lanes[1][half], s1);
+      vst1q_u32(&lanes[2][half], s2);
+      vst1q_u32(&lanes[3][half], s3);
+    }
+#else
+    for (int k = 0; k < LANES; ++k)
+    {
+      out[k] = rotl(lanes[1][k] * 5, 7) * 9;
+      uint32_t t = lanes[1][k] << 9;
+      lanes[2][k] ^= lanes[0][k];
+      lanes[3][k] ^= lanes[1][k];
+      lanes[1][k] ^= lanes[2][k];
+      lanes[0][k] ^= lanes[3][k];
+      lanes[2][k] ^= t;
+      lanes[3][k] = rotl(lanes[3][k], 11);
+    }
+#endif
+  }
+};
+
+#endif
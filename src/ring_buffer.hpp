@@ -0,0 +1,95 @@
+#ifndef RING_BUFFER_HPP_
+#define RING_BUFFER_HPP_
+
+#include <vector>
+
+// Fixed-capacity double-ended queue over one preallocated array.
+//
+// Elements are addressed from the front, so [0] is the newest PushFront() and [Size() - 1] the oldest. Capacity is
+// rounded up to a power of two and positions wrap with a mask, so every operation is O(1) and nothing is ever moved
+// or reallocated.
+template <typename T> class RingBuffer
+{
+public:
+  explicit RingBuffer(int capacity) : items(roundUp(capacity)), mask{(int)items.size() - 1}
+  {
+  }
+
+  int Capacity() const
+  {
+    return (int)items.size();
+  }
+
+  int Size() const
+  {
+    return size;
+  }
+
+  bool Empty() const
+  {
+    return size == 0;
+  }
+
+  bool Full() const
+  {
+    return size == Capacity();
+  }
+
+  void Clear()
+  {
+    front = 0;
+    size = 0;
+  }
+
+  // The caller checks Full() first
+  void PushFront(const T &item)
+  {
+    front = (front - 1) & mask;
+    items[front] = item;
+    ++size;
+  }
+
+  void PushBack(const T &item)
+  {
+    items[(front + size) & mask] = item;
+    ++size;
+  }
+
+  void PopBack()
+  {
+    --size;
+  }
+
+  const T &Front() const
+  {
+    return items[front];
+  }
+
+  const T &Back() const
+  {
+    return items[(front + size - 1) & mask];
+  }
+
+  const T &operator[](int i) const
+  {
+    return items[(front + i) & mask];
+  }
+
+private:
+  std::vector<T> items;
+  int mask;
+  int front = 0;
+  int size = 0;
+
+  static size_t roundUp(int capacity)
+  {
+    size_t rounded = 1;
+    while (rounded < (size_t)capacity)
+    {
+      rounded *= 2;
+    }
+    return rounded;
+  }
+};
+
+#endif
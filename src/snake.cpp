@@ -1,186 +1,59 @@
 #include "../include/raylib-cpp.hpp"
+#include "game_loop.hpp"
+#include "input_log.hpp"
+#include "random.hpp"
 #include "raylib.h"
+#include "snake_sim.hpp"
 
-#include <array>
+#include <cstdio>
 
 namespace
 {
-const int SNAKE_LENGTH = 256;
-const int SQUARE_SIZE = 31;
-
-struct Snake
-{
-  raylib::Vector2 position;
-  raylib::Vector2 size;
-  raylib::Vector2 speed;
-  raylib::Color color;
-};
+using namespace snake;
 
-struct Food
-{
-  raylib::Vector2 position;
-  raylib::Vector2 size;
-  bool active;
-  raylib::Color color;
-};
+const int SQUARE_SIZE = 31;
+const int TICKS_PER_SECOND = 40; // the snake steps one square every fifth tick
 
 const int SCREEN_WIDTH = 800;
 const int SCREEN_HEIGHT = 450;
+const int COLUMNS = SCREEN_WIDTH / SQUARE_SIZE;
+const int ROWS = SCREEN_HEIGHT / SQUARE_SIZE;
 
-int framesCounter;
-bool isGameOver;
-bool isPaused;
+constexpr raylib::Color HEAD_COLOR = ::DARKBLUE;
+constexpr raylib::Color BODY_COLOR = ::BLUE;
+constexpr raylib::Color FRUIT_COLOR = ::SKYBLUE;
 
-Food fruit = {0};
-std::array<Snake, SNAKE_LENGTH> snake;
-std::array<raylib::Vector2, SNAKE_LENGTH> snakePosition;
-bool allowMove;
+Random rng;
+SnakeSim sim{COLUMNS, ROWS, rng};
 raylib::Vector2 offset;
-int counterTail;
 
+InputSession session{TICKS_PER_SECOND};
+FixedStepLoop loop{TICKS_PER_SECOND};
+
+raylib::Vector2 positionOf(int cell);
 void InitGame();
 void UpdateGame();
 void DrawGame();
 void UpdateDrawFrame();
 
-void InitGame()
+// Top-left corner of a grid square
+raylib::Vector2 positionOf(int cell)
 {
-  framesCounter = 0;
-  isGameOver = false;
-  isPaused = false;
-
-  counterTail = 1;
-  allowMove = false;
+  return raylib::Vector2{(cell % COLUMNS) * SQUARE_SIZE + offset.x / 2, (cell / COLUMNS) * SQUARE_SIZE + offset.y / 2};
+}
 
+void InitGame()
+{
   offset.x = SCREEN_WIDTH % SQUARE_SIZE;
   offset.y = SCREEN_HEIGHT % SQUARE_SIZE;
 
-  for (int i = 0; i < SNAKE_LENGTH; ++i)
-  {
-    snake[i].position = raylib::Vector2{offset.x / 2, offset.y / 2};
-    snake[i].size = raylib::Vector2{SQUARE_SIZE, SQUARE_SIZE};
-    snake[i].speed = raylib::Vector2{SQUARE_SIZE, 0};
-
-    snake[i].color = (i == 0) ? ::DARKBLUE : ::BLUE;
-  }
-
-  for (int i = 0; i < SNAKE_LENGTH; ++i)
-  {
-    snakePosition[i] = (raylib::Vector2){0.0f, 0.0f};
-  }
-
-  fruit.size = (raylib::Vector2){SQUARE_SIZE, SQUARE_SIZE};
-  fruit.color = SKYBLUE;
-  fruit.active = false;
+  sim.Reset();
 }
 
-// Update game (one frame)
+// Update game (one tick)
 void UpdateGame()
 {
-  if (!isGameOver)
-  {
-    if (IsKeyPressed('P'))
-      isPaused = !isPaused;
-
-    if (!isPaused)
-    {
-      // Player control
-      if (IsKeyPressed(KEY_RIGHT) && (snake[0].speed.x == 0) && allowMove)
-      {
-        snake[0].speed = (raylib::Vector2){SQUARE_SIZE, 0};
-        allowMove = false;
-      }
-      if (IsKeyPressed(KEY_LEFT) && (snake[0].speed.x == 0) && allowMove)
-      {
-        snake[0].speed = (raylib::Vector2){-SQUARE_SIZE, 0};
-        allowMove = false;
-      }
-      if (IsKeyPressed(KEY_UP) && (snake[0].speed.y == 0) && allowMove)
-      {
-        snake[0].speed = (raylib::Vector2){0, -SQUARE_SIZE};
-        allowMove = false;
-      }
-      if (IsKeyPressed(KEY_DOWN) && (snake[0].speed.y == 0) && allowMove)
-      {
-        snake[0].speed = (raylib::Vector2){0, SQUARE_SIZE};
-        allowMove = false;
-      }
-
-      // Snake movement
-      for (int i = 0; i < counterTail; ++i)
-        snakePosition[i] = snake[i].position;
-
-      if ((framesCounter % 5) == 0)
-      {
-        for (int i = 0; i < counterTail; ++i)
-        {
-          if (i == 0)
-          {
-            snake[0].position.x += snake[0].speed.x;
-            snake[0].position.y += snake[0].speed.y;
-            allowMove = true;
-          }
-          else
-            snake[i].position = snakePosition[i - 1];
-        }
-      }
-
-      // Wall behaviour
-      if (((snake[0].position.x) > (SCREEN_WIDTH - offset.x)) || ((snake[0].position.y) > (SCREEN_HEIGHT - offset.y)) ||
-          (snake[0].position.x < 0) || (snake[0].position.y < 0))
-      {
-        isGameOver = true;
-      }
-
-      // Collision with yourself
-      for (int i = 1; i < counterTail; ++i)
-      {
-        if ((snake[0].position.x == snake[i].position.x) && (snake[0].position.y == snake[i].position.y))
-          isGameOver = true;
-      }
-
-      // Fruit position calculation
-      if (!fruit.active)
-      {
-        fruit.active = true;
-        fruit.position =
-            (raylib::Vector2){GetRandomValue(0, (SCREEN_WIDTH / SQUARE_SIZE) - 1) * SQUARE_SIZE + offset.x / 2,
-                              GetRandomValue(0, (SCREEN_HEIGHT / SQUARE_SIZE) - 1) * SQUARE_SIZE + offset.y / 2};
-
-        for (int i = 0; i < counterTail; ++i)
-        {
-          while ((fruit.position.x == snake[i].position.x) && (fruit.position.y == snake[i].position.y))
-          {
-            fruit.position =
-                (raylib::Vector2){GetRandomValue(0, (SCREEN_WIDTH / SQUARE_SIZE) - 1) * SQUARE_SIZE + offset.x / 2,
-                                  GetRandomValue(0, (SCREEN_HEIGHT / SQUARE_SIZE) - 1) * SQUARE_SIZE + offset.y / 2};
-            i = 0;
-          }
-        }
-      }
-
-      // Collision
-      if ((snake[0].position.x < (fruit.position.x + fruit.size.x) &&
-           (snake[0].position.x + snake[0].size.x) > fruit.position.x) &&
-          (snake[0].position.y < (fruit.position.y + fruit.size.y) &&
-           (snake[0].position.y + snake[0].size.y) > fruit.position.y))
-      {
-        snake[counterTail].position = snakePosition[counterTail - 1];
-        counterTail += 1;
-        fruit.active = false;
-      }
-
-      framesCounter++;
-    }
-  }
-  else
-  {
-    if (IsKeyPressed(KEY_ENTER))
-    {
-      InitGame();
-      isGameOver = false;
-    }
-  }
+  sim.Step(SnakeInput::FromTick(session.NextTick()));
 }
 
 // Draw game (one frame)
@@ -190,7 +63,7 @@ void DrawGame()
 
   ClearBackground(RAYWHITE);
 
-  if (!isGameOver)
+  if (!sim.isGameOver)
   {
     // Draw grid lines
     for (int i = 0; i < SCREEN_WIDTH / SQUARE_SIZE + 1; ++i)
@@ -206,15 +79,19 @@ void DrawGame()
     }
 
     // Draw snake
-    for (int i = 0; i < counterTail; ++i)
+    raylib::Vector2 squareSize{SQUARE_SIZE, SQUARE_SIZE};
+    for (int i = 0; i < sim.body.Size(); ++i)
     {
-      DrawRectangleV(snake[i].position, snake[i].size, snake[i].color);
+      DrawRectangleV(positionOf(sim.body[i]), squareSize, (i == 0) ? HEAD_COLOR : BODY_COLOR);
     }
 
     // Draw fruit to pick
-    DrawRectangleV(fruit.position, fruit.size, fruit.color);
+    if (sim.fruit.active)
+    {
+      DrawRectangleV(positionOf(sim.fruit.cell), squareSize, FRUIT_COLOR);
+    }
 
-    if (isPaused)
+    if (sim.isPaused)
     {
       DrawText("GAME PAUSED", SCREEN_WIDTH / 2 - MeasureText("GAME PAUSED", 40) / 2, SCREEN_HEIGHT / 2 - 40, 40, GRAY);
     }
@@ -226,25 +103,36 @@ void DrawGame()
   EndDrawing();
 }
 
-// Update and Draw (one frame)
+// Update and Draw (one frame). Movement is a whole square at a time, so there is nothing to interpolate.
 void UpdateDrawFrame()
 {
-  UpdateGame();
+  session.Poll();
+  loop.Advance(::GetFrameTime(), UpdateGame);
   DrawGame();
 }
 
 } // namespace
 
-int main()
+int main(int argc, char **argv)
 {
+  session.Open(argc, argv);
   raylib::Window window{SCREEN_WIDTH, SCREEN_HEIGHT, "Sample Game: Snake"};
+  session.SeedRandom(rng);
   InitGame();
   ::SetTargetFPS(40);
 
+  if (session.IsReplay())
+  {
+    session.Replay(UpdateGame);
+    std::printf("final length %d, game over %d\n", sim.body.Size(), sim.isGameOver);
+    return 0;
+  }
+
   while (!window.ShouldClose())
   {
     UpdateDrawFrame();
   }
 
+  session.Finish();
   return 0;
 }
@@ -0,0 +1,195 @@
+#ifndef SNAKE_SIM_HPP_
+#define SNAKE_SIM_HPP_
+
+#include "game_loop.hpp"
+#include "occupancy_grid.hpp"
+#include "random.hpp"
+#include "ring_buffer.hpp"
+
+// Snake game rules on a board of any size, free of any window, input polling or GL calls.
+// All storage is sized by the board up front, so Step() never allocates.
+namespace snake
+{
+// Controls sampled for one tick, all edge-triggered presses
+struct SnakeInput
+{
+  bool left = false;
+  bool right = false;
+  bool up = false;
+  bool down = false;
+  bool pause = false;
+  bool restart = false;
+
+  static SnakeInput FromTick(const TickInput &keys)
+  {
+    SnakeInput input;
+    input.left = keys.Pressed(INPUT_LEFT);
+    input.right = keys.Pressed(INPUT_RIGHT);
+    input.up = keys.Pressed(INPUT_UP);
+    input.down = keys.Pressed(INPUT_DOWN);
+    input.pause = keys.Pressed(INPUT_PAUSE);
+    input.restart = keys.Pressed(INPUT_ENTER);
+    return input;
+  }
+};
+
+struct Food
+{
+  int cell = 0;
+  bool active = false;
+};
+
+class SnakeSim
+{
+public:
+  bool isGameOver = false;
+  bool isPaused = false;
+  int framesCounter = 0;
+  bool allowMove = false;
+
+  RingBuffer<int> body;    // board squares, head first; the snake can grow until it covers the board
+  int speedX = 1;          // squares per move
+  int speedY = 0;
+  OccupancyGrid occupancy; // squares covered by the snake
+  Food fruit;
+
+  // The snake moves one square every ticksPerMove ticks
+  SnakeSim(int columns, int rows, Random &rng, int ticksPerMove = 5)
+      : body{columns * rows}, occupancy{columns, rows}, rng{rng}, ticksPerMove{ticksPerMove}
+  {
+    Reset();
+  }
+
+  int Columns() const
+  {
+    return occupancy.Columns();
+  }
+
+  int Rows() const
+  {
+    return occupancy.Rows();
+  }
+
+  void Reset()
+  {
+    framesCounter = 0;
+    isGameOver = false;
+    isPaused = false;
+    allowMove = false;
+
+    body.Clear();
+    body.PushFront(occupancy.CellOf(0, 0));
+    speedX = 1;
+    speedY = 0;
+
+    occupancy.Reset();
+    occupancy.Set(body.Front());
+
+    fruit.active = false;
+  }
+
+  // Advance the game by one tick
+  void Step(const SnakeInput &input)
+  {
+    if (isGameOver)
+    {
+      if (input.restart)
+      {
+        Reset();
+      }
+      return;
+    }
+
+    if (input.pause)
+    {
+      isPaused = !isPaused;
+    }
+
+    if (isPaused)
+    {
+      return;
+    }
+
+    // Player control
+    if (input.right && (speedX == 0) && allowMove)
+    {
+      turn(1, 0);
+    }
+    if (input.left && (speedX == 0) && allowMove)
+    {
+      turn(-1, 0);
+    }
+    if (input.up && (speedY == 0) && allowMove)
+    {
+      turn(0, -1);
+    }
+    if (input.down && (speedY == 0) && allowMove)
+    {
+      turn(0, 1);
+    }
+
+    // Snake movement: the head moves onto a new square and the tail follows unless the snake is eating
+    if ((framesCounter % ticksPerMove) == 0)
+    {
+      allowMove = true;
+
+      int column = body.Front() % Columns() + speedX;
+      int row = body.Front() / Columns() + speedY;
+
+      // Wall behaviour
+      if (!occupancy.Contains(column, row))
+      {
+        isGameOver = true;
+      }
+      else
+      {
+        int head = occupancy.CellOf(column, row);
+        bool eating = fruit.active && head == fruit.cell;
+
+        // The tail leaves its square before the head enters one, so following the tail closely is allowed
+        if (!eating)
+        {
+          occupancy.Clear(body.Back());
+          body.PopBack();
+        }
+
+        // Collision with yourself
+        if (occupancy.Test(head))
+        {
+          isGameOver = true;
+        }
+
+        occupancy.Set(head);
+        body.PushFront(head);
+
+        if (eating)
+        {
+          fruit.active = false;
+        }
+      }
+    }
+
+    // Fruit position calculation, uniform over the free squares
+    if (!fruit.active && occupancy.FreeCount() > 0)
+    {
+      fruit.active = true;
+      fruit.cell = occupancy.SelectFree(rng.GetRandomValue(0, occupancy.FreeCount() - 1));
+    }
+
+    framesCounter++;
+  }
+
+private:
+  Random &rng;
+  int ticksPerMove;
+
+  void turn(int x, int y)
+  {
+    speedX = x;
+    speedY = y;
+    allowMove = false;
+  }
+};
+} // namespace snake
+
+#endif
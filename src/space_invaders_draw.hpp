@@ -0,0 +1,109 @@
+#ifndef SPACE_INVADERS_DRAW_HPP_
+#define SPACE_INVADERS_DRAW_HPP_
+
+#include "../include/raylib-cpp.hpp"
+#include "raylib.h"
+#include "space_invaders_sim.hpp"
+
+// How a Space Invaders frame is drawn, written against a draw target so the same calls go to the window or, headless,
+// into a raylib::SoftwareRenderer. A target has ClearBackground(), DrawTexture(texture, position, rotation, scale,
+// tint), DrawRectangle(rec, color), DrawText(), MeasureText() and Draw(texture, quads, count) for the sprite batch.
+namespace space_invaders
+{
+// The screen, between ::BeginDrawing() and ::EndDrawing()
+struct ScreenTarget
+{
+  void ClearBackground(::Color color)
+  {
+    ::ClearBackground(color);
+  }
+
+  void DrawTexture(const ::Texture2D &texture, ::Vector2 position, float rotation, float scale, ::Color tint)
+  {
+    ::DrawTextureEx(texture, position, rotation, scale, tint);
+  }
+
+  void DrawRectangle(::Rectangle rec, ::Color color)
+  {
+    ::DrawRectangleRec(rec, color);
+  }
+
+  void DrawText(const char *text, int posX, int posY, int fontSize, ::Color color)
+  {
+    ::DrawText(text, posX, posY, fontSize, color);
+  }
+
+  int MeasureText(const char *text, int fontSize) const
+  {
+    return ::MeasureText(text, fontSize);
+  }
+
+  void Draw(const ::Texture2D &texture, const raylib::SpriteBatch::Quad *quads, int count)
+  {
+    raylib::SpriteBatch::SubmitQuads(texture, quads, count);
+  }
+};
+
+// Draw sim into target, blend is how far we are between the last tick and the next one. The player and the enemies
+// come from the "player" and "enemy" sprites of atlas, uploaded as atlasTexture, and go out through sprites.
+template <typename Target>
+void DrawSpaceInvaders(Target &target, const SpaceInvadersSim &sim, float blend, const ::Texture2D &background,
+                       const raylib::TextureAtlas &atlas, const ::Texture2D &atlasTexture, raylib::SpriteBatch &sprites)
+{
+  auto centered = [&target](const char *text, int y, int fontSize, ::Color color) {
+    target.DrawText(text, SCREEN_WIDTH / 2 - target.MeasureText(text, fontSize) / 2, y, fontSize, color);
+  };
+
+  target.ClearBackground(::RAYWHITE);
+
+  if (!sim.isGameOver)
+  {
+    target.DrawTexture(background, raylib::Vector2{0, 0}, 0.0f, 0.7f, ::GRAY);
+
+    // Draw Player
+    float playerX = LerpFloat(sim.previousPlayerPosition.x, sim.player.rec.x, blend);
+    float playerY = LerpFloat(sim.previousPlayerPosition.y, sim.player.rec.y, blend);
+    sprites.Add(atlasTexture, atlas.Get("player"), raylib::Vector2{playerX + PLAYER_WIDTH * 2, playerY - 5}, 90.0f,
+                0.35f, ::WHITE);
+
+    // Draw enemies, in the same batch as the player
+    ::Rectangle enemySprite = atlas.Get("enemy");
+    sim.enemies.ForEachLive([&](int i) {
+      sprites.Add(atlasTexture, enemySprite, raylib::Vector2{sim.enemies.Interpolated(i, blend)}, 0.0f, 0.16f,
+                  sim.enemyColors[i]);
+    });
+    sprites.Flush([&target](const ::Texture2D &texture, const raylib::SpriteBatch::Quad *quads, int count) {
+      target.Draw(texture, quads, count);
+    });
+
+    // Draw bullets
+    sim.bullets.ForEachLive([&](int i) {
+      raylib::Vector2 position{sim.bullets.Interpolated(i, blend)};
+      target.DrawRectangle(::Rectangle{position.x, position.y, sim.bullets.w[i], sim.bullets.h[i]}, sim.bulletColor);
+    });
+
+    target.DrawText(::TextFormat("%04i", sim.score), 20, 20, 40, ::RAYWHITE);
+
+    if (sim.victory)
+    {
+      centered("YOU'VE WON!", SCREEN_HEIGHT / 2 - 40, 40, ::WHITE);
+    }
+
+    if (sim.isPaused)
+    {
+      centered("GAME PAUSED", SCREEN_HEIGHT / 2 - 40, 40, ::RAYWHITE);
+    }
+  }
+  else
+  {
+    target.DrawTexture(background, raylib::Vector2{0, 0}, 0.0f, 0.7f, ::DARKGRAY);
+    centered("PRESS [ENTER] TO PLAY AGAIN", SCREEN_HEIGHT / 2 - 50, 30, ::RAYWHITE);
+  }
+
+  // Announce the wave, fading out
+  const char *waves[] = {"FIRST WAVE", "SECOND WAVE", "THIRD WAVE"};
+  centered(waves[sim.wave], SCREEN_HEIGHT / 2 - 40, 40, ::Fade(::WHITE, sim.alpha));
+}
+} // namespace space_invaders
+
+#endif
@@ -0,0 +1,355 @@
+#ifndef SPACE_INVADERS_SIM_HPP_
+#define SPACE_INVADERS_SIM_HPP_
+
+#include "../include/raylib-cpp.hpp"
+#include "entity_pool.hpp"
+#include "game_loop.hpp"
+#include "random.hpp"
+#include "raylib.h"
+#include "spatial_hash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+// Space Invaders game rules, free of any window, input polling or GL calls.
+// Every SpaceInvadersSim owns its full state and draws from the Random it is given, so many can be stepped side by
+// side in one process.
+namespace space_invaders
+{
+const int SCREEN_WIDTH = 1200;
+const int SCREEN_HEIGHT = 700;
+
+const int NUM_BULLETS = 50;
+const int NUM_MAX_ENEMIES = 50;
+const int FIRST_WAVE_ENEMIES = 15;
+const int SECOND_WAVE_ENEMIES = 30;
+const int THIRD_WAVE_ENEMIES = NUM_MAX_ENEMIES;
+const int PLAYER_HEIGHT = 50;
+const int PLAYER_WIDTH = 20;
+const int ENEMY_HEIGHT = 35;
+const int ENEMY_WIDTH = 45;
+const int ENEMY_SPEED = 2;
+const int BULLET_WIDTH = 10;
+const int BULLET_HEIGHT = 5;
+const int BULLET_SPEED = 4;
+const float COLLISION_CELL_SIZE = 64.0f;
+constexpr std::array<raylib::Color, 3> ENEMY_COLOR_POOL{raylib::Color{238, 237, 49}, raylib::Color{243, 49, 242},
+                                                        raylib::Color{38, 233, 235}};
+
+enum EnemyWave
+{
+  FIRST_WAVE,
+  SECOND_WAVE,
+  THIRD_WAVE
+};
+
+struct Player
+{
+  raylib::Rectangle rec;
+  raylib::Vector2 speed;
+  raylib::Color color;
+
+  Player() = default;
+  Player(raylib::Rectangle _rec, raylib::Vector2 _speed, raylib::Color _color) : rec{_rec}, speed{_speed}, color{_color}
+  {
+  }
+};
+
+// Controls sampled for one tick. Held keys are levels, pause/restart are edge-triggered presses.
+struct SpaceInvadersInput
+{
+  bool left = false;
+  bool right = false;
+  bool up = false;
+  bool down = false;
+  bool fire = false;
+  bool pause = false;
+  bool restart = false;
+
+  static SpaceInvadersInput FromTick(const TickInput &keys)
+  {
+    SpaceInvadersInput input;
+    input.left = keys.Held(INPUT_LEFT);
+    input.right = keys.Held(INPUT_RIGHT);
+    input.up = keys.Held(INPUT_UP);
+    input.down = keys.Held(INPUT_DOWN);
+    input.fire = keys.Held(INPUT_SPACE);
+    input.pause = keys.Pressed(INPUT_PAUSE);
+    input.restart = keys.Pressed(INPUT_ENTER);
+    return input;
+  }
+};
+
+// Same test as ::CheckCollisionRecs, kept inline so the hot loops don't call into the library
+inline bool Overlaps(const ::Rectangle &a, const ::Rectangle &b)
+{
+  return a.x < b.x + b.width && a.x + a.width > b.x && a.y < b.y + b.height && a.y + a.height > b.y;
+}
+
+class SpaceInvadersSim
+{
+public:
+  bool isGameOver = false;
+  bool isPaused = false;
+  int score = 0;
+  bool victory = false;
+
+  Player player;
+  raylib::Vector2 previousPlayerPosition; // player.rec position at the start of the last tick
+  EntityPool enemies{NUM_MAX_ENEMIES};
+  std::array<raylib::Color, NUM_MAX_ENEMIES> enemyColors;
+  EntityPool bullets{NUM_BULLETS};
+  raylib::Color bulletColor = ::YELLOW;
+  EnemyWave wave = FIRST_WAVE;
+
+  int bulletRate = 0;
+  int activeEnemies = FIRST_WAVE_ENEMIES;
+  int enemyKills = 0;
+
+  // Wave banner fade, advanced with the simulation so it stays in step with wave changes
+  float alpha = 0.0f;
+  bool isOpaque = false;
+  float duration = 0.0f;
+
+  // Broadphase over the enemies currently in play, ids are indices into enemies
+  SpatialHash enemyGrid{COLLISION_CELL_SIZE, NUM_MAX_ENEMIES};
+
+  // Slot lists produced by the pool passes, kept around so ticks don't allocate
+  std::vector<int> scratch;
+
+  explicit SpaceInvadersSim(Random &rng) : rng{rng}
+  {
+    Reset();
+  }
+
+  void Reset()
+  {
+    isGameOver = false;
+    isPaused = false;
+    score = 0;
+    victory = false;
+
+    player = Player{raylib::Rectangle{20, 50, PLAYER_WIDTH, PLAYER_HEIGHT}, raylib::Vector2{3, 3}, ::WHITE};
+    previousPlayerPosition = raylib::Vector2{player.rec.x, player.rec.y};
+    wave = FIRST_WAVE;
+
+    bulletRate = 0;
+    activeEnemies = FIRST_WAVE_ENEMIES;
+    enemyKills = 0;
+
+    alpha = 0.0f;
+    isOpaque = false;
+    duration = 0.0f;
+
+    enemies.Clear();
+    enemyGrid.Clear();
+    spawnEnemies();
+
+    bullets.Clear();
+  }
+
+  // Advance the game by one tick
+  void Step(const SpaceInvadersInput &input)
+  {
+    previousPlayerPosition = raylib::Vector2{player.rec.x, player.rec.y};
+
+    if (isGameOver)
+    {
+      if (input.restart)
+      {
+        Reset();
+      }
+      return;
+    }
+
+    if (input.pause)
+    {
+      isPaused = !isPaused;
+    }
+
+    if (isPaused)
+    {
+      return;
+    }
+
+    tuneAlpha();
+
+    // Ready to move on to next wave
+    if (enemyKills == activeEnemies)
+    {
+      if (wave == FIRST_WAVE)
+      {
+        wave = SECOND_WAVE;
+        activeEnemies = SECOND_WAVE_ENEMIES;
+        initNextWave();
+      }
+      else if (wave == SECOND_WAVE)
+      {
+        wave = THIRD_WAVE;
+        activeEnemies = THIRD_WAVE_ENEMIES;
+        initNextWave();
+      }
+      else
+      {
+        victory = true;
+      }
+    }
+
+    // Player movement
+    if (input.right)
+    {
+      player.rec.x += player.speed.x;
+    }
+    if (input.left)
+    {
+      player.rec.x -= player.speed.x;
+    }
+    if (input.up)
+    {
+      player.rec.y -= player.speed.y;
+    }
+    if (input.down)
+    {
+      player.rec.y += player.speed.y;
+    }
+
+    // Player collision with enemies
+    enemyGrid.Query(player.rec, [this](int i) {
+      if (Overlaps(player.rec, enemies.Rec(i)))
+      {
+        isGameOver = true;
+      }
+    });
+
+    // Enemy behaviour
+    enemies.MoveX(-1.0f);
+
+    scratch.clear();
+    enemies.CollectLeftOf(0.0f, scratch);
+    for (int i : scratch)
+    {
+      respawnEnemy(i);
+    }
+
+    enemies.ForEachLive([this](int i) { enemyGrid.Update(i, enemies.Rec(i)); });
+
+    // Wall limits
+    player.rec.x = std::max(player.rec.x, 0.0f);
+    player.rec.x = std::min(player.rec.x, SCREEN_WIDTH - player.rec.width);
+    player.rec.y = std::max(player.rec.y, 0.0f);
+    player.rec.y = std::min(player.rec.y, SCREEN_HEIGHT - player.rec.height);
+
+    // Bullet spawning
+    if (input.fire)
+    {
+      bulletRate += 3;
+
+      if (bulletRate % 20 == 0)
+      {
+        bullets.Acquire(::Rectangle{player.rec.x, player.rec.y + player.rec.height / 2, BULLET_WIDTH, BULLET_HEIGHT},
+                        BULLET_SPEED);
+      }
+    }
+
+    // Bullet logic
+    bullets.MoveX(1.0f);
+
+    bullets.ForEachLive([this](int i) {
+      ::Rectangle bulletRec = bullets.Rec(i);
+
+      // Collision with enemies, the lowest index wins when several overlap
+      int hit = -1;
+      enemyGrid.Query(bulletRec, [&](int j) {
+        if (Overlaps(bulletRec, enemies.Rec(j)) && (hit < 0 || j < hit))
+        {
+          hit = j;
+        }
+      });
+
+      if (hit >= 0)
+      {
+        bullets.Release(i);
+        bulletRate = 0;
+        ++enemyKills;
+        score += 100;
+        respawnEnemy(hit);
+      }
+    });
+
+    scratch.clear();
+    bullets.CollectRightOf(SCREEN_WIDTH, scratch);
+    for (int i : scratch)
+    {
+      bullets.Release(i);
+      bulletRate = 0;
+    }
+  }
+
+private:
+  Random &rng;
+
+  // Spawn positions drawn in bulk, one entry per enemy that can be in play
+  std::array<int, NUM_MAX_ENEMIES> spawnX;
+  std::array<int, NUM_MAX_ENEMIES> spawnY;
+
+  void tuneAlpha()
+  {
+    if (!isOpaque)
+    {
+      alpha += 0.02f;
+      if (alpha >= 1.0f)
+      {
+        isOpaque = true;
+      }
+    }
+    else // TODO: somewhere need to reset duration back to 0.0f
+    {
+      duration += 0.02f;
+      if (duration >= 1.0f)
+      {
+        alpha -= 0.02f;
+      }
+    }
+  }
+
+  void initNextWave()
+  {
+    enemyKills = 0;
+    spawnEnemies();
+
+    isOpaque = false; // so that text can fade in upon next wave
+    alpha = 0.0f;
+  }
+
+  // Top the enemies in play up to activeEnemies
+  void spawnEnemies()
+  {
+    int count = activeEnemies - enemies.Size();
+    if (count <= 0)
+    {
+      return;
+    }
+    rng.Fill(spawnX.data(), count, SCREEN_WIDTH, SCREEN_WIDTH + 1000);
+    rng.Fill(spawnY.data(), count, 0, SCREEN_HEIGHT - ENEMY_HEIGHT);
+
+    for (int k = 0; k < count; ++k)
+    {
+      raylib::Rectangle enemyRec{(float)spawnX[k], (float)spawnY[k], ENEMY_WIDTH, ENEMY_HEIGHT};
+      int i = enemies.Acquire(enemyRec, ENEMY_SPEED);
+      enemyColors[i] = ENEMY_COLOR_POOL[rng.GetRandomValue(0, (int)ENEMY_COLOR_POOL.size() - 1)];
+      enemyGrid.Insert(i, enemyRec);
+    }
+  }
+
+  void respawnEnemy(int i)
+  {
+    float x = (float)rng.GetRandomValue(SCREEN_WIDTH, SCREEN_WIDTH * 2);
+    float y = (float)rng.GetRandomValue(0, SCREEN_HEIGHT - ENEMY_HEIGHT);
+    enemies.SetPosition(i, x, y);
+    enemyGrid.Update(i, enemies.Rec(i));
+  }
+};
+} // namespace space_invaders
+
+#endif
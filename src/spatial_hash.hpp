@@ -0,0 +1,195 @@
+#ifndef SPATIAL_HASH_HPP_
+#define SPATIAL_HASH_HPP_
+
+#include "../include/raylib-cpp.hpp"
+#include "raylib.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// Uniform-grid spatial hash over raylib rectangles.
+//
+// Objects are identified by a dense integer id in [0, capacity). Each object is binned into every grid cell its
+// rectangle touches; Update() only re-bins an object when that cell range actually changes, so slow movers cost a
+// single comparison per tick. Query() visits each object whose cells overlap the area exactly once. The caller still
+// runs the exact rectangle test on the candidates.
+class SpatialHash
+{
+public:
+  SpatialHash(float cellSize, int capacity)
+      : cellSize{cellSize}, invCellSize{1.0f / cellSize}, ranges(capacity), stamps(capacity, 0)
+  {
+    size_t bucketCount = 16;
+    while (bucketCount < (size_t)capacity * 2)
+    {
+      bucketCount *= 2;
+    }
+    buckets.resize(bucketCount);
+    mask = bucketCount - 1;
+  }
+
+  int Capacity() const
+  {
+    return (int)ranges.size();
+  }
+
+  float GetCellSize() const
+  {
+    return cellSize;
+  }
+
+  bool Contains(int id) const
+  {
+    return ranges[id].present;
+  }
+
+  void Clear()
+  {
+    for (auto &bucket : buckets)
+    {
+      bucket.clear();
+    }
+    for (auto &range : ranges)
+    {
+      range.present = false;
+    }
+  }
+
+  // Insert the object, or move it if it is already present
+  void Update(int id, const ::Rectangle &rec)
+  {
+    CellRange next = cellsOf(rec);
+    CellRange &current = ranges[id];
+
+    if (current.present)
+    {
+      if (current.x0 == next.x0 && current.y0 == next.y0 && current.x1 == next.x1 && current.y1 == next.y1)
+      {
+        return;
+      }
+      unlink(id, current);
+    }
+
+    link(id, next);
+    current = next;
+  }
+
+  void Insert(int id, const ::Rectangle &rec)
+  {
+    Update(id, rec);
+  }
+
+  void Remove(int id)
+  {
+    CellRange &current = ranges[id];
+    if (current.present)
+    {
+      unlink(id, current);
+      current.present = false;
+    }
+  }
+
+  // Call visit(id) once for every object sharing a grid cell with area
+  template <typename Visitor> void Query(const ::Rectangle &area, Visitor &&visit)
+  {
+    CellRange range = cellsOf(area);
+    uint32_t queryStamp = nextStamp();
+
+    for (int cy = range.y0; cy <= range.y1; ++cy)
+    {
+      for (int cx = range.x0; cx <= range.x1; ++cx)
+      {
+        for (const Entry &entry : buckets[bucketOf(cx, cy)])
+        {
+          if (entry.cx == cx && entry.cy == cy && stamps[entry.id] != queryStamp)
+          {
+            stamps[entry.id] = queryStamp;
+            visit(entry.id);
+          }
+        }
+      }
+    }
+  }
+
+private:
+  struct CellRange
+  {
+    int x0 = 0, y0 = 0, x1 = -1, y1 = -1;
+    bool present = false;
+  };
+
+  struct Entry
+  {
+    int cx, cy, id;
+  };
+
+  float cellSize;
+  float invCellSize;
+  std::vector<std::vector<Entry>> buckets;
+  size_t mask = 0;
+  std::vector<CellRange> ranges;
+  std::vector<uint32_t> stamps;
+  uint32_t stamp = 0;
+
+  CellRange cellsOf(const ::Rectangle &rec) const
+  {
+    CellRange range;
+    range.x0 = (int)std::floor(rec.x * invCellSize);
+    range.y0 = (int)std::floor(rec.y * invCellSize);
+    range.x1 = (int)std::floor((rec.x + rec.width) * invCellSize);
+    range.y1 = (int)std::floor((rec.y + rec.height) * invCellSize);
+    range.present = true;
+    return range;
+  }
+
+  size_t bucketOf(int cx, int cy) const
+  {
+    return ((uint32_t)cx * 73856093u ^ (uint32_t)cy * 19349663u) & mask;
+  }
+
+  uint32_t nextStamp()
+  {
+    if (++stamp == 0)
+    {
+      // Wrapped around: forget every old stamp so none can alias the new one
+      std::fill(stamps.begin(), stamps.end(), 0);
+      stamp = 1;
+    }
+    return stamp;
+  }
+
+  void link(int id, const CellRange &range)
+  {
+    for (int cy = range.y0; cy <= range.y1; ++cy)
+    {
+      for (int cx = range.x0; cx <= range.x1; ++cx)
+      {
+        buckets[bucketOf(cx, cy)].push_back(Entry{cx, cy, id});
+      }
+    }
+  }
+
+  void unlink(int id, const CellRange &range)
+  {
+    for (int cy = range.y0; cy <= range.y1; ++cy)
+    {
+      for (int cx = range.x0; cx <= range.x1; ++cx)
+      {
+        auto &bucket = buckets[bucketOf(cx, cy)];
+        for (size_t i = 0; i < bucket.size(); ++i)
+        {
+          if (bucket[i].id == id && bucket[i].cx == cx && bucket[i].cy == cy)
+          {
+            bucket[i] = bucket.back();
+            bucket.pop_back();
+            break;
+          }
+        }
+      }
+    }
+  }
+};
+
+#endif
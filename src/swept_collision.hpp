@@ -0,0 +1,143 @@
+#ifndef SWEPT_COLLISION_HPP_
+#define SWEPT_COLLISION_HPP_
+
+#include "raylib.h"
+
+#include <algorithm>
+#include <cmath>
+
+// First contact of a moving shape with a static one
+struct SweepHit
+{
+  bool hit = false;
+  float time = 1.0f;      // fraction of the motion covered before contact, in [0, 1]
+  ::Vector2 normal{0, 0}; // unit normal of the surface that was hit, pointing towards the moving shape
+};
+
+// Sweep a circle from center along motion against a rectangle.
+//
+// The circle touches the rectangle exactly when its center touches the rectangle grown by the radius with rounded
+// corners, so this casts the center as a ray: first against the grown box with a slab test, then, if the entry point
+// lies in a corner region, against the circle around that corner. A circle that already overlaps the rectangle and
+// keeps moving into it reports a hit at time 0; one that is moving out reports no hit, so it can leave freely.
+inline SweepHit SweepCircleRec(::Vector2 center, float radius, ::Vector2 motion, const ::Rectangle &rec)
+{
+  SweepHit result;
+  float left = rec.x, right = rec.x + rec.width, top = rec.y, bottom = rec.y + rec.height;
+
+  // Already overlapping
+  float dx = center.x - std::clamp(center.x, left, right);
+  float dy = center.y - std::clamp(center.y, top, bottom);
+  if (dx * dx + dy * dy <= radius * radius)
+  {
+    ::Vector2 normal{0, 0};
+    if (dx != 0 || dy != 0)
+    {
+      float length = std::sqrt(dx * dx + dy * dy);
+      normal = ::Vector2{dx / length, dy / length};
+    }
+    else
+    {
+      // Center inside the rectangle: push out through the nearest side
+      float toLeft = center.x - left, toRight = right - center.x, toTop = center.y - top, toBottom = bottom - center.y;
+      float nearest = std::min(std::min(toLeft, toRight), std::min(toTop, toBottom));
+      normal = nearest == toLeft    ? ::Vector2{-1, 0}
+               : nearest == toRight ? ::Vector2{1, 0}
+               : nearest == toTop   ? ::Vector2{0, -1}
+                                    : ::Vector2{0, 1};
+    }
+
+    if (motion.x * normal.x + motion.y * normal.y < 0)
+    {
+      result.hit = true;
+      result.time = 0.0f;
+      result.normal = normal;
+    }
+    return result;
+  }
+
+  // Slab test against the rectangle grown by the radius
+  float enter = -INFINITY, exit = INFINITY;
+  ::Vector2 enterNormal{0, 0};
+  if (motion.x != 0)
+  {
+    float t0 = (left - radius - center.x) / motion.x, t1 = (right + radius - center.x) / motion.x;
+    if (t0 > t1)
+    {
+      std::swap(t0, t1);
+    }
+    enter = t0;
+    exit = t1;
+    enterNormal = ::Vector2{motion.x > 0 ? -1.0f : 1.0f, 0};
+  }
+  else if (center.x < left - radius || center.x > right + radius)
+  {
+    return result;
+  }
+  if (motion.y != 0)
+  {
+    float t0 = (top - radius - center.y) / motion.y, t1 = (bottom + radius - center.y) / motion.y;
+    if (t0 > t1)
+    {
+      std::swap(t0, t1);
+    }
+    if (t0 > enter)
+    {
+      enter = t0;
+      enterNormal = ::Vector2{0, motion.y > 0 ? -1.0f : 1.0f};
+    }
+    exit = std::min(exit, t1);
+  }
+  else if (center.y < top - radius || center.y > bottom + radius)
+  {
+    return result;
+  }
+  if (enter > exit || enter > 1.0f || exit < 0.0f)
+  {
+    return result;
+  }
+
+  // Entering through a flat side
+  float t = std::max(enter, 0.0f);
+  float x = center.x + motion.x * t, y = center.y + motion.y * t;
+  bool besideX = x >= left && x <= right;
+  bool besideY = y >= top && y <= bottom;
+  if (enter >= 0.0f && (besideX || besideY))
+  {
+    result.hit = true;
+    result.time = enter;
+    result.normal = enterNormal;
+    return result;
+  }
+
+  // Entering through a rounded corner: first root of |center + motion * t - corner| = radius
+  ::Vector2 corner{x < left ? left : right, y < top ? top : bottom};
+  float fx = center.x - corner.x, fy = center.y - corner.y;
+  float a = motion.x * motion.x + motion.y * motion.y;
+  float b = fx * motion.x + fy * motion.y;
+  float c = fx * fx + fy * fy - radius * radius;
+  float discriminant = b * b - a * c;
+  if (b >= 0 || discriminant < 0)
+  {
+    return result;
+  }
+  float root = (-b - std::sqrt(discriminant)) / a;
+  if (root < 0.0f || root > 1.0f)
+  {
+    return result;
+  }
+
+  result.hit = true;
+  result.time = root;
+  result.normal = ::Vector2{(fx + motion.x * root) / radius, (fy + motion.y * root) / radius};
+  return result;
+}
+
+// Velocity after bouncing off a surface with the given unit normal
+inline ::Vector2 Reflect(::Vector2 velocity, ::Vector2 normal)
+{
+  float along = velocity.x * normal.x + velocity.y * normal.y;
+  return ::Vector2{velocity.x - 2 * along * normal.x, velocity.y - 2 * along * normal.y};
+}
+
+#endif
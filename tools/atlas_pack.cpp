@@ -0,0 +1,62 @@
+#include "../include/TextureAtlas.hpp"
+#include "raylib.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Packs sprite images into one atlas image plus a table of "name x y width height" lines, to be read back at runtime
+// with raylib::TextureAtlas::Load(). A sprite is named after its file, without directory and extension.
+// Compile command:  g++ atlas_pack.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out <atlas.png> <atlas.txt> <sprite.png>...
+//   e.g.            ./a.out ../assets/space_atlas.png ../assets/space_atlas.txt ../assets/space_*.png
+
+namespace
+{
+const int PADDING = 2;
+
+std::string spriteName(const std::string &fileName)
+{
+  size_t start = fileName.find_last_of("/\\");
+  start = start == std::string::npos ? 0 : start + 1;
+  size_t end = fileName.find_last_of('.');
+  end = end == std::string::npos || end < start ? fileName.size() : end;
+  return fileName.substr(start, end - start);
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  if (argc < 4)
+  {
+    std::fprintf(stderr, "usage: %s <atlas.png> <atlas.txt> <sprite.png>...\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  std::vector<std::pair<std::string, std::string>> files;
+  for (int i = 3; i < argc; ++i)
+  {
+    files.emplace_back(spriteName(argv[i]), argv[i]);
+  }
+
+  raylib::TextureAtlas atlas;
+  bool packed = atlas.Pack(files, PADDING);
+  if (!atlas.Export(argv[1], argv[2]))
+  {
+    std::fprintf(stderr, "Could not write atlas table %s\n", argv[2]);
+    return EXIT_FAILURE;
+  }
+
+  long long used = 0;
+  for (const auto &entry : atlas.GetTable())
+  {
+    used += (long long)entry.second.width * (long long)entry.second.height;
+  }
+  const raylib::Image &image = atlas.GetImage();
+  std::printf("%d of %d sprites in a %dx%d atlas, %.1f%% covered\n", (int)atlas.GetTable().size(), argc - 3,
+              image.width, image.height, 100.0 * used / ((double)image.width * image.height));
+
+  return packed ? 0 : EXIT_FAILURE;
+}
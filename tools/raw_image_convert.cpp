@@ -0,0 +1,74 @@
+#include "../include/MappedImage.hpp"
+#include "raylib.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// Bakes images into .rawimg files for raylib::MappedImage, each written next to its input with the extension
+// replaced. Uncompressed images are stored as 32 bit RGBA, compressed ones (DDS, KTX, PKM, ...) as they are.
+// Compile command:  g++ raw_image_convert.cpp -O2 -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c++17
+// Usage:            ./a.out [--mipmaps] <image>...
+//   e.g.            ./a.out ../assets/*.png
+
+namespace
+{
+std::string rawName(const std::string &fileName)
+{
+  size_t start = fileName.find_last_of("/\\");
+  start = start == std::string::npos ? 0 : start + 1;
+  size_t end = fileName.find_last_of('.');
+  end = end == std::string::npos || end < start ? fileName.size() : end;
+  return fileName.substr(0, end) + ".rawimg";
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  bool mipmaps = argc > 1 && std::strcmp(argv[1], "--mipmaps") == 0;
+  int first = mipmaps ? 2 : 1;
+  if (argc <= first)
+  {
+    std::fprintf(stderr, "usage: %s [--mipmaps] <image>...\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  ::SetTraceLogLevel(::LOG_WARNING);
+  int failed = 0;
+  for (int i = first; i < argc; ++i)
+  {
+    ::Image image = ::LoadImage(argv[i]);
+    if (image.data == nullptr)
+    {
+      std::fprintf(stderr, "Could not load %s\n", argv[i]);
+      ++failed;
+      continue;
+    }
+    if (image.format < COMPRESSED_DXT1_RGB)
+    {
+      ::ImageFormat(&image, UNCOMPRESSED_R8G8B8A8);
+      if (mipmaps)
+      {
+        ::ImageMipmaps(&image);
+      }
+    }
+
+    std::string output = rawName(argv[i]);
+    if (!raylib::MappedImage::Export(image, output))
+    {
+      std::fprintf(stderr, "Could not write %s\n", output.c_str());
+      ++failed;
+    }
+    else
+    {
+      std::printf("%s: %dx%d, %d mipmaps, format %d, %llu bytes\n", output.c_str(), image.width, image.height,
+                  image.mipmaps, image.format,
+                  (unsigned long long)raylib::MappedImage::DataSize(image.width, image.height, image.mipmaps,
+                                                                    image.format));
+    }
+    ::UnloadImage(image);
+  }
+
+  return failed == 0 ? 0 : EXIT_FAILURE;
+}